@@ -0,0 +1,229 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "grpc_arena.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::gRPCAstarteDatastreamIndividual;
+using AstarteDeviceSdk::gRPCAstarteDatastreamObject;
+using AstarteDeviceSdk::gRPCAstarteMessage;
+using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcConverterTo;
+using AstarteDeviceSdk::GrpcMessageArena;
+using gRPCMessageHubEvent = astarteplatform::msghub::MessageHubEvent;
+
+// Count all the heap allocations performed by the process.
+namespace {
+std::atomic<std::uint64_t> allocations{0};
+}  // namespace
+
+auto operator new(std::size_t size) -> void* {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+auto operator new[](std::size_t size) -> void* { return ::operator new(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+
+namespace {
+
+constexpr std::string_view interface_name("org.astarte-platform.cpp.bench.DeviceDatastream");
+constexpr std::string_view path("/sensor/value");
+
+const auto timestamp = std::chrono::system_clock::now();
+const AstarteData individual_data(std::vector<double>{1.0, 2.0, 3.0, 4.0});
+const AstarteDatastreamObject object_data = {{"temperature", AstarteData(21.5)},
+                                             {"humidity", AstarteData(int32_t{40})},
+                                             {"label", AstarteData(std::string("kitchen"))}};
+
+// Report the number of heap allocations performed on average by each iteration.
+class AllocationCounter {
+ public:
+  explicit AllocationCounter(benchmark::State& state)
+      : state_(state), start_(allocations.load(std::memory_order_relaxed)) {}
+  ~AllocationCounter() {
+    const std::uint64_t count = allocations.load(std::memory_order_relaxed) - start_;
+    state_.counters["allocs_per_msg"] = benchmark::Counter(
+        static_cast<double>(count), benchmark::Counter::kAvgIterations);
+  }
+  AllocationCounter(const AllocationCounter&) = delete;
+  AllocationCounter(AllocationCounter&&) = delete;
+  auto operator=(const AllocationCounter&) -> AllocationCounter& = delete;
+  auto operator=(AllocationCounter&&) -> AllocationCounter& = delete;
+
+ private:
+  benchmark::State& state_;
+  std::uint64_t start_;
+};
+
+auto serialized_event() -> std::string {
+  gRPCMessageHubEvent event;
+  gRPCAstarteMessage* message = event.mutable_message();
+  message->set_interface_name(std::string(interface_name));
+  message->set_path(std::string(path));
+  GrpcConverterTo::fill(object_data, &timestamp, message->mutable_datastream_object());
+  return event.SerializeAsString();
+}
+
+}  // namespace
+
+// Outgoing message built on the heap, transferring ownership of each nested message.
+static void BM_BuildIndividualHeap(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    gRPCAstarteMessage message;
+    message.set_interface_name(interface_name);
+    message.set_path(path);
+    std::unique_ptr<gRPCAstarteDatastreamIndividual> individual =
+        GrpcConverterTo{}(individual_data, &timestamp);
+    message.set_allocated_datastream_individual(individual.release());
+    benchmark::DoNotOptimize(message.ByteSizeLong());
+  }
+}
+BENCHMARK(BM_BuildIndividualHeap);
+
+// Outgoing message built on an arena, as done by the send functions.
+static void BM_BuildIndividualArena(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    GrpcMessageArena arena;
+    auto* message = arena.create<gRPCAstarteMessage>();
+    message->set_interface_name(interface_name);
+    message->set_path(path);
+    GrpcConverterTo::fill(individual_data, &timestamp, message->mutable_datastream_individual());
+    benchmark::DoNotOptimize(message->ByteSizeLong());
+  }
+}
+BENCHMARK(BM_BuildIndividualArena);
+
+static void BM_BuildObjectHeap(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    gRPCAstarteMessage message;
+    message.set_interface_name(interface_name);
+    message.set_path(path);
+    std::unique_ptr<gRPCAstarteDatastreamObject> object =
+        GrpcConverterTo{}(object_data, &timestamp);
+    message.set_allocated_datastream_object(object.release());
+    benchmark::DoNotOptimize(message.ByteSizeLong());
+  }
+}
+BENCHMARK(BM_BuildObjectHeap);
+
+static void BM_BuildObjectArena(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    GrpcMessageArena arena;
+    auto* message = arena.create<gRPCAstarteMessage>();
+    message->set_interface_name(interface_name);
+    message->set_path(path);
+    GrpcConverterTo::fill(object_data, &timestamp, message->mutable_datastream_object());
+    benchmark::DoNotOptimize(message->ByteSizeLong());
+  }
+}
+BENCHMARK(BM_BuildObjectArena);
+
+// Incoming event parsed into a new heap message, then converted.
+static void BM_ParseEventHeap(benchmark::State& state) {
+  const std::string bytes = serialized_event();
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    gRPCMessageHubEvent event;
+    event.ParseFromString(bytes);
+    auto res = GrpcConverterFrom{}(event.message());
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(BM_ParseEventHeap);
+
+// Incoming event parsed on an arena reset after each event, as done by the event handler.
+static void BM_ParseEventArena(benchmark::State& state) {
+  const std::string bytes = serialized_event();
+  GrpcMessageArena arena;
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    auto* event = arena.create<gRPCMessageHubEvent>();
+    event->ParseFromString(bytes);
+    auto res = GrpcConverterFrom{}(event->message());
+    benchmark::DoNotOptimize(res);
+    arena.reset();
+  }
+}
+BENCHMARK(BM_ParseEventArena);
+
+// Incoming event parsed on an arena and consumed by the conversion, moving its strings.
+static void BM_ParseEventArenaConsuming(benchmark::State& state) {
+  const std::string bytes = serialized_event();
+  GrpcMessageArena arena;
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    auto* event = arena.create<gRPCMessageHubEvent>();
+    event->ParseFromString(bytes);
+    auto res = GrpcConverterFrom{}(std::move(*event->mutable_message()));
+    benchmark::DoNotOptimize(res);
+    arena.reset();
+  }
+}
+BENCHMARK(BM_ParseEventArenaConsuming);
+
+// Copy of a data payload, as done when sharing received data between consumers.
+static void BM_CopyDataBlob(benchmark::State& state) {
+  const AstarteData data(std::vector<uint8_t>(static_cast<std::size_t>(state.range(0)), 0xAB));
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    AstarteData copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["sizeof_data"] = static_cast<double>(sizeof(AstarteData));
+}
+BENCHMARK(BM_CopyDataBlob)->Arg(64)->Arg(4096);
+
+static void BM_CopyObject(benchmark::State& state) {
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    AstarteDatastreamObject copy = object_data;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_CopyObject);
+
+// Object of many fields built in place, as done by aggregated telemetry.
+static void BM_BuildObjectReserved(benchmark::State& state) {
+  const std::vector<std::string> paths = {"f00", "f01", "f02", "f03", "f04", "f05",
+                                          "f06", "f07", "f08", "f09", "f10", "f11"};
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    AstarteDatastreamObject object;
+    object.reserve(paths.size());
+    for (const auto& path : paths) {
+      object.insert(path, AstarteData(21.5));
+    }
+    benchmark::DoNotOptimize(object.find("f07"));
+  }
+}
+BENCHMARK(BM_BuildObjectReserved);
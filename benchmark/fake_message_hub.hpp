@@ -0,0 +1,214 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef FAKE_MESSAGE_HUB_H
+#define FAKE_MESSAGE_HUB_H
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <astarteplatform/msghub/node.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Minimal in-process message hub used as a sink by the benchmarks and the unit tests.
+ * @details Accepts any Attach request, keeps the event stream open until the node detaches and
+ * acknowledges every Send. Received messages are only stored when recording is enabled, and
+ * Send can be delayed to keep calls in flight. Published messages are written on the event stream.
+ */
+class FakeMessageHub final : public astarteplatform::msghub::MessageHub::Service {
+ public:
+  /**
+   * @brief Start the server on a free local port.
+   * @param record True to store a copy of every message received through Send.
+   */
+  explicit FakeMessageHub(bool record = false) : record_(record) {
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port_);
+    builder.RegisterService(this);
+    server_ = builder.BuildAndStart();
+  }
+  /** @brief Stop the server, terminating any open event stream. */
+  ~FakeMessageHub() override {
+    detach();
+    server_->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(1));
+  }
+  FakeMessageHub(const FakeMessageHub&) = delete;
+  FakeMessageHub(FakeMessageHub&&) = delete;
+  auto operator=(const FakeMessageHub&) -> FakeMessageHub& = delete;
+  auto operator=(FakeMessageHub&&) -> FakeMessageHub& = delete;
+
+  /** @return The address the server is listening on. */
+  [[nodiscard]] auto address() const -> std::string { return "127.0.0.1:" + std::to_string(port_); }
+  /** @return The number of messages received through Send. */
+  [[nodiscard]] auto received() const -> std::uint64_t { return received_.load(); }
+  /** @return The number of messages received through Send and acknowledged. */
+  [[nodiscard]] auto acknowledged() const -> std::uint64_t { return acknowledged_.load(); }
+  /** @return The highest number of Send calls handled at the same time. */
+  [[nodiscard]] auto max_in_flight() const -> std::uint64_t { return max_in_flight_.load(); }
+  /** @return A copy of the recorded messages, in the order they were received. */
+  [[nodiscard]] auto messages() -> std::vector<astarteplatform::msghub::AstarteMessage> {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return messages_;
+  }
+  /**
+   * @brief Delay the response to each Send.
+   * @param delay The time each Send waits before acknowledging the message.
+   */
+  void set_send_delay(std::chrono::milliseconds delay) { send_delay_ms_.store(delay.count()); }
+  /**
+   * @brief Make each Send fail instead of acknowledging the message.
+   * @param fail True to answer Send with an unavailable status.
+   */
+  void set_fail_sends(bool fail) { fail_sends_.store(fail); }
+  /**
+   * @brief Send a message to the attached node through the event stream.
+   * @param message The message to deliver, sent once a node is attached.
+   */
+  void publish(astarteplatform::msghub::AstarteMessage message) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      pending_.push_back(std::move(message));
+    }
+    cv_.notify_all();
+  }
+  /**
+   * @brief Close the event stream of the attached node with an error, as a hub restart would.
+   * @details The node is expected to attach again.
+   */
+  void interrupt_stream() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      interrupted_ = true;
+    }
+    cv_.notify_all();
+  }
+  /** @return The number of Attach requests received. */
+  [[nodiscard]] auto attach_count() const -> std::uint64_t { return attach_count_.load(); }
+  /** @return True while a node is attached to the event stream. */
+  [[nodiscard]] auto attached() -> bool {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return attached_;
+  }
+
+  auto Attach(grpc::ServerContext* context, const astarteplatform::msghub::Node* /*request*/,
+              grpc::ServerWriter<astarteplatform::msghub::MessageHubEvent>* writer)
+      -> grpc::Status override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      detached_ = false;
+      interrupted_ = false;
+      attached_ = true;
+    }
+    attach_count_.fetch_add(1);
+    // The device checks for the initial metadata to confirm the attach was successful
+    context->AddInitialMetadata("node-attached", "true");
+    writer->SendInitialMetadata();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!detached_ && !interrupted_ && !context->IsCancelled()) {
+      std::vector<astarteplatform::msghub::AstarteMessage> pending;
+      pending.swap(pending_);
+      if (!pending.empty()) {
+        lock.unlock();
+        for (auto& message : pending) {
+          astarteplatform::msghub::MessageHubEvent event;
+          *event.mutable_message() = std::move(message);
+          writer->Write(event);
+        }
+        lock.lock();
+        continue;
+      }
+      cv_.wait_for(lock, std::chrono::milliseconds(50));
+    }
+    attached_ = false;
+    if (interrupted_) {
+      return {grpc::StatusCode::UNAVAILABLE, "Stream interrupted by the test"};
+    }
+    return grpc::Status::OK;
+  }
+
+  auto Send(grpc::ServerContext* /*context*/,
+            const astarteplatform::msghub::AstarteMessage* request,
+            google::protobuf::Empty* /*response*/) -> grpc::Status override {
+    const InFlight in_flight(*this);
+    if (record_) {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      messages_.push_back(*request);
+    }
+    if (const auto delay = send_delay_ms_.load(); delay != 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+    }
+    received_.fetch_add(1, std::memory_order_relaxed);
+    if (fail_sends_.load()) {
+      return {grpc::StatusCode::UNAVAILABLE, "Send failure requested by the test"};
+    }
+    acknowledged_.fetch_add(1, std::memory_order_relaxed);
+    return grpc::Status::OK;
+  }
+
+  auto Detach(grpc::ServerContext* /*context*/, const google::protobuf::Empty* /*request*/,
+              google::protobuf::Empty* /*response*/) -> grpc::Status override {
+    detach();
+    return grpc::Status::OK;
+  }
+
+ private:
+  // Tracks the Send calls being handled for the lifetime of the instance
+  class InFlight {
+   public:
+    explicit InFlight(FakeMessageHub& hub) : hub_(hub) {
+      const auto current = hub_.in_flight_.fetch_add(1) + 1;
+      auto max = hub_.max_in_flight_.load();
+      while (max < current && !hub_.max_in_flight_.compare_exchange_weak(max, current)) {
+      }
+    }
+    ~InFlight() { hub_.in_flight_.fetch_sub(1); }
+    InFlight(const InFlight&) = delete;
+    InFlight(InFlight&&) = delete;
+    auto operator=(const InFlight&) -> InFlight& = delete;
+    auto operator=(InFlight&&) -> InFlight& = delete;
+
+   private:
+    FakeMessageHub& hub_;
+  };
+
+  void detach() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      detached_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  int port_{0};
+  std::unique_ptr<grpc::Server> server_;
+  std::atomic<std::uint64_t> received_{0};
+  std::atomic<std::uint64_t> acknowledged_{0};
+  std::atomic<std::uint64_t> in_flight_{0};
+  std::atomic<std::uint64_t> max_in_flight_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool detached_{false};
+  bool attached_{false};
+  bool interrupted_{false};
+  std::atomic<std::uint64_t> attach_count_{0};
+  const bool record_;
+  std::vector<astarteplatform::msghub::AstarteMessage> messages_;
+  std::vector<astarteplatform::msghub::AstarteMessage> pending_;
+  std::atomic<std::chrono::milliseconds::rep> send_delay_ms_{0};
+  std::atomic_bool fail_sends_{false};
+};
+
+#endif  // FAKE_MESSAGE_HUB_H
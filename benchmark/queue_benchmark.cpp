@@ -0,0 +1,86 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "shared_queue.hpp"
+#include "spsc_queue.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::SharedQueue;
+using AstarteDeviceSdk::SpscQueue;
+
+namespace {
+
+constexpr std::chrono::milliseconds pop_timeout(100);
+
+auto make_message(std::int64_t value) -> AstarteMessage {
+  return {"org.astarte-platform.cpp.bench.ServerDatastream", "/sensor/value",
+          AstarteDatastreamIndividual(AstarteData(std::to_string(value)))};
+}
+
+}  // namespace
+
+// A producer thread pushes the messages, the benchmark thread pops them one at a time.
+template <typename Queue>
+static void BM_ReceptionQueuePop(benchmark::State& state) {
+  const std::int64_t count = state.range(0);
+  for (auto _ : state) {
+    Queue queue;
+    std::jthread producer([&queue, count]() {
+      for (std::int64_t i = 0; i < count; ++i) {
+        queue.push(make_message(i));
+      }
+    });
+    for (std::int64_t i = 0; i < count; ++i) {
+      std::optional<AstarteMessage> message = queue.pop(pop_timeout);
+      benchmark::DoNotOptimize(message);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ReceptionQueuePop, SharedQueue<AstarteMessage>)
+    ->Arg(10000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReceptionQueuePop, SpscQueue<AstarteMessage>)->Arg(10000)->UseRealTime();
+
+// A producer thread pushes the messages, the benchmark thread drains them in batches.
+template <typename Queue>
+static void BM_ReceptionQueuePopBatch(benchmark::State& state) {
+  const std::int64_t count = state.range(0);
+  std::vector<AstarteMessage> out;
+  for (auto _ : state) {
+    Queue queue;
+    std::jthread producer([&queue, count]() {
+      for (std::int64_t i = 0; i < count; ++i) {
+        queue.push(make_message(i));
+      }
+    });
+    std::int64_t received = 0;
+    while (received < count) {
+      out.clear();
+      received += static_cast<std::int64_t>(queue.pop_batch(out, 64, pop_timeout));
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ReceptionQueuePopBatch, SharedQueue<AstarteMessage>)
+    ->Arg(10000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ReceptionQueuePopBatch, SpscQueue<AstarteMessage>)
+    ->Arg(10000)
+    ->UseRealTime();
@@ -0,0 +1,180 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "astarte_device_sdk/series.hpp"
+#include "fake_message_hub.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamSeries;
+using AstarteDeviceSdk::AstarteDeviceGrpc;
+using AstarteDeviceSdk::AstarteOutgoingMessage;
+using AstarteDeviceSdk::AstarteOverflowPolicy;
+
+namespace {
+
+constexpr std::string_view interface_name("org.astarte-platform.cpp.bench.DeviceDatastream");
+constexpr std::string_view path("/sensor/value");
+constexpr std::size_t outbound_queue_capacity = 4096;
+constexpr std::string_view interface_json = R"({
+  "interface_name": "org.astarte-platform.cpp.bench.DeviceDatastream",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/%{sensor}/value", "type": "double", "explicit_timestamp": true}]
+})";
+
+// Shared between all the benchmarks, the connection is performed only once.
+struct Environment {
+  explicit Environment(bool queued)
+      : device(hub.address(), "aa04dade-9401-4c37-8c6a-d8da15b083ae") {
+    spdlog::set_level(spdlog::level::warn);
+    (void)device.add_interface_from_str(interface_json);
+    if (queued) {
+      (void)device.set_outbound_queue(outbound_queue_capacity, AstarteOverflowPolicy::kBlock);
+    }
+    (void)device.connect();
+    while (!device.is_connected()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  ~Environment() { (void)device.disconnect(); }
+  Environment(const Environment&) = delete;
+  Environment(Environment&&) = delete;
+  auto operator=(const Environment&) -> Environment& = delete;
+  auto operator=(Environment&&) -> Environment& = delete;
+
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device;
+};
+
+auto environment() -> Environment& {
+  static Environment env(false);
+  return env;
+}
+
+auto queued_environment() -> Environment& {
+  static Environment env(true);
+  return env;
+}
+
+auto make_samples(std::int64_t count) -> std::vector<AstarteOutgoingMessage> {
+  std::vector<AstarteOutgoingMessage> samples;
+  samples.reserve(static_cast<std::size_t>(count));
+  const auto now = std::chrono::system_clock::now();
+  for (std::int64_t i = 0; i < count; ++i) {
+    samples.emplace_back(interface_name, path,
+                         AstarteDatastreamIndividual(AstarteData(static_cast<double>(i))),
+                         now + std::chrono::milliseconds(i));
+  }
+  return samples;
+}
+
+}  // namespace
+
+// One send_individual call per sample, as done by a naive acquisition loop.
+static void BM_SendIndividualLoop(benchmark::State& state) {
+  AstarteDeviceGrpc& device = environment().device;
+  const auto samples = make_samples(state.range(0));
+  for (auto _ : state) {
+    for (const auto& sample : samples) {
+      const auto& individual = std::get<AstarteDatastreamIndividual>(sample.get_raw_data());
+      auto res = device.send_individual(sample.get_interface(), sample.get_path(),
+                                        individual.get_value(), &sample.get_timestamp().value());
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SendIndividualLoop)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
+
+// One send_individual call per sample, through an endpoint handle prepared once.
+static void BM_SendIndividualHandle(benchmark::State& state) {
+  AstarteDeviceGrpc& device = environment().device;
+  const auto samples = make_samples(state.range(0));
+  auto handle = device.prepare(interface_name, path);
+  if (!handle) {
+    state.SkipWithError("Could not prepare the endpoint");
+    return;
+  }
+  for (auto _ : state) {
+    for (const auto& sample : samples) {
+      const auto& individual = std::get<AstarteDatastreamIndividual>(sample.get_raw_data());
+      auto res = handle->send_individual(individual.get_value(), &sample.get_timestamp().value());
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SendIndividualHandle)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
+
+// All the samples submitted with a single send_batch call.
+static void BM_SendBatch(benchmark::State& state) {
+  AstarteDeviceGrpc& device = environment().device;
+  const auto samples = make_samples(state.range(0));
+  for (auto _ : state) {
+    auto res = device.send_batch(samples);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SendBatch)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
+
+// All the samples submitted with a single send_series call, stored as a column of doubles.
+static void BM_SendSeries(benchmark::State& state) {
+  AstarteDeviceGrpc& device = environment().device;
+  const auto count = static_cast<std::size_t>(state.range(0));
+  AstarteDatastreamSeries series(std::vector<double>{}, {});
+  series.reserve(count);
+  const auto now = std::chrono::system_clock::now();
+  for (std::size_t i = 0; i < count; ++i) {
+    series.push_back(static_cast<double>(i), now + std::chrono::milliseconds(i));
+  }
+  for (auto _ : state) {
+    auto res = device.send_series(interface_name, path, series);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SendSeries)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
+
+// Samples enqueued in the outbound queue, waiting for the sender thread to deliver all of them.
+static void BM_SendIndividualQueued(benchmark::State& state) {
+  Environment& env = queued_environment();
+  const auto samples = make_samples(state.range(0));
+  for (auto _ : state) {
+    const std::uint64_t target = env.hub.received() + samples.size();
+    for (const auto& sample : samples) {
+      const auto& individual = std::get<AstarteDatastreamIndividual>(sample.get_raw_data());
+      auto res = env.device.send_individual(sample.get_interface(), sample.get_path(),
+                                            individual.get_value(),
+                                            &sample.get_timestamp().value());
+      benchmark::DoNotOptimize(res);
+    }
+    while (env.hub.received() < target) {
+      std::this_thread::yield();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SendIndividualQueued)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
@@ -0,0 +1,93 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "subscription_router.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::SubscriptionRouter;
+
+namespace {
+
+constexpr int interfaces_count = 30;
+constexpr int endpoints_count = 10;
+
+auto interface_name(int index) -> std::string {
+  return "org.astarte-platform.cpp.bench.ServerDatastream" + std::to_string(index);
+}
+
+auto endpoint(int index) -> std::string { return "/endpoint" + std::to_string(index); }
+
+// Messages spread over all the subscribed endpoints
+auto make_messages() -> std::vector<AstarteMessage> {
+  std::vector<AstarteMessage> messages;
+  for (int i = 0; i < interfaces_count; ++i) {
+    for (int j = 0; j < endpoints_count; ++j) {
+      messages.emplace_back(interface_name(i), "/sensor" + endpoint(j),
+                            AstarteDatastreamIndividual(AstarteData(int32_t{1})));
+    }
+  }
+  return messages;
+}
+
+}  // namespace
+
+// Route the messages through the subscriptions to 300 endpoints.
+static void BM_RouteSubscriptions(benchmark::State& state) {
+  SubscriptionRouter router;
+  std::int64_t handled = 0;
+  for (int i = 0; i < interfaces_count; ++i) {
+    for (int j = 0; j < endpoints_count; ++j) {
+      (void)router.subscribe(interface_name(i), "/%{sensor}" + endpoint(j),
+                             [&handled](const AstarteMessage&) { handled++; });
+    }
+  }
+  const std::vector<AstarteMessage> messages = make_messages();
+  for (auto _ : state) {
+    for (const auto& message : messages) {
+      benchmark::DoNotOptimize(router.route(message));
+    }
+  }
+  state.SetItemsProcessed(handled);
+}
+BENCHMARK(BM_RouteSubscriptions);
+
+// Route the messages with a linear chain of comparisons, as done by a polling consumer.
+static void BM_RouteLinearScan(benchmark::State& state) {
+  struct Route {
+    std::string interface_name;
+    std::string suffix;
+  };
+  std::vector<Route> routes;
+  for (int i = 0; i < interfaces_count; ++i) {
+    for (int j = 0; j < endpoints_count; ++j) {
+      routes.push_back({interface_name(i), endpoint(j)});
+    }
+  }
+  std::int64_t handled = 0;
+  const std::vector<AstarteMessage> messages = make_messages();
+  for (auto _ : state) {
+    for (const auto& message : messages) {
+      for (const auto& route : routes) {
+        if ((message.get_interface() == route.interface_name) &&
+            message.get_path().ends_with(route.suffix)) {
+          handled++;
+          break;
+        }
+      }
+    }
+  }
+  state.SetItemsProcessed(handled);
+}
+BENCHMARK(BM_RouteLinearScan);
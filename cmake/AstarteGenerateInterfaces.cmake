@@ -0,0 +1,51 @@
+# (C) Copyright 2025, SECO Mind Srl
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# Path to the generator script, resolved when this module is included
+set(_ASTARTE_GENERATE_INTERFACE_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/astarte_generate_interface.cmake")
+
+# Generate typed C++ headers from the JSON definitions of Astarte interfaces.
+#
+#   astarte_generate_interfaces(
+#       TARGET <target>
+#       INTERFACES <json files>...
+#       [OUTPUT_DIRECTORY <directory>]
+#   )
+#
+# A header named after each JSON file, with the .hpp extension, is generated in the
+# astarte_interfaces folder of the output directory, which defaults to the current binary
+# directory. The output directory is added to the include directories of the target. Headers are
+# regenerated when their JSON definition changes.
+function(astarte_generate_interfaces)
+    cmake_parse_arguments(PARSE_ARGV 0 ARG "" "TARGET;OUTPUT_DIRECTORY" "INTERFACES")
+    if(NOT ARG_TARGET)
+        message(FATAL_ERROR "astarte_generate_interfaces: TARGET is required.")
+    endif()
+    if(NOT ARG_INTERFACES)
+        message(FATAL_ERROR "astarte_generate_interfaces: INTERFACES is required.")
+    endif()
+    if(NOT ARG_OUTPUT_DIRECTORY)
+        set(ARG_OUTPUT_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/astarte_generated")
+    endif()
+
+    set(_headers)
+    foreach(_json IN LISTS ARG_INTERFACES)
+        get_filename_component(_json "${_json}" ABSOLUTE)
+        get_filename_component(_json_name "${_json}" NAME_WLE)
+        set(_header "${ARG_OUTPUT_DIRECTORY}/astarte_interfaces/${_json_name}.hpp")
+        add_custom_command(
+            OUTPUT "${_header}"
+            COMMAND
+                ${CMAKE_COMMAND} -DASTARTE_INTERFACE_JSON=${_json}
+                -DASTARTE_INTERFACE_HEADER=${_header} -P ${_ASTARTE_GENERATE_INTERFACE_SCRIPT}
+            DEPENDS "${_json}" "${_ASTARTE_GENERATE_INTERFACE_SCRIPT}"
+            COMMENT "Generating Astarte interface ${_json_name}"
+            VERBATIM
+        )
+        list(APPEND _headers "${_header}")
+    endforeach()
+
+    target_sources(${ARG_TARGET} PRIVATE ${_headers})
+    target_include_directories(${ARG_TARGET} PRIVATE "${ARG_OUTPUT_DIRECTORY}")
+endfunction()
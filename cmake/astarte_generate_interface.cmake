@@ -0,0 +1,260 @@
+# (C) Copyright 2025, SECO Mind Srl
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# Generate the typed C++ header of an Astarte interface, run in script mode by the custom commands
+# created by astarte_generate_interfaces.
+#
+# Input variables:
+#   ASTARTE_INTERFACE_JSON   Path to the JSON definition of the interface.
+#   ASTARTE_INTERFACE_HEADER Path of the generated header.
+
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT ASTARTE_INTERFACE_JSON OR NOT ASTARTE_INTERFACE_HEADER)
+    message(FATAL_ERROR "ASTARTE_INTERFACE_JSON and ASTARTE_INTERFACE_HEADER are required.")
+endif()
+
+file(READ "${ASTARTE_INTERFACE_JSON}" _json)
+
+# Read a member of the interface, using a default if the member is missing
+function(_astarte_json_get out_var default)
+    string(JSON _value ERROR_VARIABLE _error GET "${_json}" ${ARGN})
+    if(_error)
+        set(_value "${default}")
+    endif()
+    set(${out_var} "${_value}" PARENT_SCOPE)
+endfunction()
+
+# C++ keywords, suffixed with an underscore when used as identifiers
+set(_ASTARTE_CXX_KEYWORDS
+    alignas alignof and and_eq asm auto bitand bitor bool break case catch char char8_t char16_t
+    char32_t class compl concept const consteval constexpr constinit const_cast continue co_await
+    co_return co_yield decltype default delete do double dynamic_cast else enum explicit export
+    extern false float for friend goto if inline int long mutable namespace new noexcept not
+    not_eq nullptr operator or or_eq private protected public register reinterpret_cast requires
+    return short signed sizeof static static_assert static_cast struct switch template this
+    thread_local throw true try typedef typeid typename union unsigned using virtual void volatile
+    wchar_t while xor xor_eq
+)
+
+# Replace all the characters not allowed in a C++ identifier and the double underscores reserved
+# by the standard. Keywords get a trailing underscore, identifiers starting with a digit or with an
+# underscore and an uppercase letter a leading letter.
+function(_astarte_identifier out_var str)
+    string(REGEX REPLACE "[^A-Za-z0-9_]" "_" _id "${str}")
+    string(REGEX REPLACE "__+" "_" _id "${_id}")
+    if(_id MATCHES "^[0-9]" OR _id MATCHES "^_[A-Z]")
+        set(_id "v${_id}")
+    endif()
+    if(_id IN_LIST _ASTARTE_CXX_KEYWORDS)
+        set(_id "${_id}_")
+    endif()
+    set(${out_var} "${_id}" PARENT_SCOPE)
+endfunction()
+
+# Fail when an identifier is already taken in its scope, listing the names it's generated from.
+# Server owned interfaces have no endpoint members, so their mappings can't collide.
+function(_astarte_claim_identifier scope id source)
+    if(NOT _ownership STREQUAL "device")
+        return()
+    endif()
+    set(_claimed "${_ASTARTE_CLAIMED_${scope}}")
+    set(_sources "${_ASTARTE_SOURCES_${scope}}")
+    list(FIND _claimed "${id}" _index)
+    if(NOT _index EQUAL -1)
+        list(GET _sources ${_index} _other)
+        message(
+            FATAL_ERROR
+                "${ASTARTE_INTERFACE_JSON}: '${source}' and '${_other}' both generate the C++ "
+                "identifier '${id}'. Rename one of the two."
+        )
+    endif()
+    list(APPEND _claimed "${id}")
+    list(APPEND _sources "${source}")
+    set(_ASTARTE_CLAIMED_${scope} "${_claimed}" PARENT_SCOPE)
+    set(_ASTARTE_SOURCES_${scope} "${_sources}" PARENT_SCOPE)
+endfunction()
+
+# Convert an Astarte type name to the AstarteType enumerator
+function(_astarte_type_enum out_var type)
+    set(_names
+        binaryblob boolean datetime double integer longinteger string
+        binaryblobarray booleanarray datetimearray doublearray integerarray longintegerarray
+        stringarray
+    )
+    set(_enums
+        kBinaryBlob kBoolean kDatetime kDouble kInteger kLongInteger kString
+        kBinaryBlobArray kBooleanArray kDatetimeArray kDoubleArray kIntegerArray kLongIntegerArray
+        kStringArray
+    )
+    list(FIND _names "${type}" _index)
+    if(_index EQUAL -1)
+        message(FATAL_ERROR "${ASTARTE_INTERFACE_JSON}: unknown mapping type '${type}'.")
+    endif()
+    list(GET _enums ${_index} _enum)
+    set(${out_var} "AstarteDeviceSdk::AstarteType::${_enum}" PARENT_SCOPE)
+endfunction()
+
+_astarte_json_get(_name "" interface_name)
+if(NOT _name)
+    message(FATAL_ERROR "${ASTARTE_INTERFACE_JSON}: missing interface_name.")
+endif()
+_astarte_json_get(_version_major 0 version_major)
+_astarte_json_get(_version_minor 0 version_minor)
+_astarte_json_get(_type "" type)
+_astarte_json_get(_ownership "" ownership)
+_astarte_json_get(_aggregation "individual" aggregation)
+string(JSON _mappings_count LENGTH "${_json}" mappings)
+
+# The reverse domain of the interface name becomes the namespace, the last component the class
+string(REPLACE "." ";" _name_parts "${_name}")
+list(POP_BACK _name_parts _class_name)
+_astarte_identifier(_class_name "${_class_name}")
+set(_namespace_parts)
+foreach(_part IN LISTS _name_parts)
+    _astarte_identifier(_part "${_part}")
+    list(APPEND _namespace_parts "${_part}")
+endforeach()
+list(JOIN _namespace_parts "::" _namespace)
+
+string(TOUPPER "ASTARTE_GENERATED_${_namespace}_${_class_name}_H" _guard)
+string(REPLACE "::" "_" _guard "${_guard}")
+string(REGEX REPLACE "__+" "_" _guard "${_guard}")
+
+# Members generated for every interface, and for the object aggregation
+set(_ASTARTE_CLAIMED_interface name version_major version_minor)
+set(_ASTARTE_SOURCES_interface "the interface name" "the major version" "the minor version")
+if(_aggregation STREQUAL "object")
+    list(APPEND _ASTARTE_CLAIMED_interface Object object)
+    list(APPEND _ASTARTE_SOURCES_interface "the object type" "the object endpoint")
+    set(_ASTARTE_CLAIMED_object to_object)
+    set(_ASTARTE_SOURCES_object "the object conversion")
+endif()
+
+set(_members "")
+set(_object_fields "")
+set(_object_inserts "")
+set(_object_moves "")
+set(_object_path "")
+if(_mappings_count GREATER 0)
+    math(EXPR _last_mapping "${_mappings_count} - 1")
+    foreach(_index RANGE ${_last_mapping})
+        _astarte_json_get(_endpoint "" mappings ${_index} endpoint)
+        _astarte_json_get(_mapping_type "" mappings ${_index} type)
+        _astarte_type_enum(_enum "${_mapping_type}")
+
+        # Parameters are skipped in the member name, their value is passed with the path
+        string(REPLACE "/" ";" _segments "${_endpoint}")
+        set(_member_segments)
+        foreach(_segment IN LISTS _segments)
+            if(_segment AND NOT _segment MATCHES "^%{.*}$")
+                list(APPEND _member_segments "${_segment}")
+            endif()
+        endforeach()
+
+        if(_aggregation STREQUAL "object")
+            list(POP_BACK _segments _field)
+            list(JOIN _segments "/" _object_path)
+            _astarte_identifier(_member "${_field}")
+            _astarte_claim_identifier(object "${_member}" "${_endpoint}")
+            string(
+                APPEND _object_fields
+                "    /** @brief Value of the ${_field} mapping. */\n"
+                "    AstarteDeviceSdk::AstarteTypeTraits<${_enum}>::value_type ${_member}{};\n"
+            )
+            string(
+                APPEND _object_inserts
+                "      object.insert(\"${_field}\", AstarteDeviceSdk::AstarteData(${_member}));\n"
+            )
+            string(
+                APPEND _object_moves
+                "      object.insert(\"${_field}\", "
+                "AstarteDeviceSdk::AstarteData(std::move(${_member})));\n"
+            )
+        else()
+            list(JOIN _member_segments "_" _member)
+            _astarte_identifier(_member "${_member}")
+            _astarte_claim_identifier(interface "${_member}" "${_endpoint}")
+            if(_type STREQUAL "properties")
+                set(_endpoint_class "AstartePropertyEndpoint")
+            else()
+                set(_endpoint_class "AstarteDatastreamEndpoint")
+            endif()
+            string(
+                APPEND _members
+                "  /** @brief Endpoint ${_endpoint} of type ${_mapping_type}. */\n"
+                "  static constexpr AstarteDeviceSdk::${_endpoint_class}<${_enum}> ${_member}{\n"
+                "      name, \"${_endpoint}\"};\n"
+            )
+        endif()
+    endforeach()
+endif()
+
+if(_aggregation STREQUAL "object")
+    string(
+        CONCAT _members
+        "  /** @brief The values of all the mappings of the interface, sent together. */\n"
+        "  struct Object {\n"
+        "${_object_fields}"
+        "\n"
+        "    /** @return The object to transmit, built with a single allocation. */\n"
+        "    [[nodiscard]] auto to_object() const& -> AstarteDeviceSdk::AstarteDatastreamObject {\n"
+        "      AstarteDeviceSdk::AstarteDatastreamObject object;\n"
+        "      object.reserve(${_mappings_count});\n"
+        "${_object_inserts}"
+        "      return object;\n"
+        "    }\n"
+        "    /** @return The object to transmit, with the values moved into it. */\n"
+        "    [[nodiscard]] auto to_object() && -> AstarteDeviceSdk::AstarteDatastreamObject {\n"
+        "      AstarteDeviceSdk::AstarteDatastreamObject object;\n"
+        "      object.reserve(${_mappings_count});\n"
+        "${_object_moves}"
+        "      return object;\n"
+        "    }\n"
+        "  };\n"
+        "  /** @brief Endpoint ${_object_path} of the object. */\n"
+        "  static constexpr AstarteDeviceSdk::AstarteObjectEndpoint<Object> object{\n"
+        "      name, \"${_object_path}\"};\n"
+    )
+endif()
+
+# Only the name and version of server owned interfaces are generated, they can't be sent
+if(NOT _ownership STREQUAL "device")
+    set(_members "")
+endif()
+
+get_filename_component(_json_name "${ASTARTE_INTERFACE_JSON}" NAME)
+file(
+    WRITE "${ASTARTE_INTERFACE_HEADER}.tmp"
+    "// Generated by astarte_generate_interfaces from ${_json_name}, do not edit.\n"
+    "\n"
+    "#ifndef ${_guard}\n"
+    "#define ${_guard}\n"
+    "\n"
+    "#include <cstdint>\n"
+    "#include <string_view>\n"
+    "#include <utility>\n"
+    "\n"
+    "#include \"astarte_device_sdk/typed_endpoint.hpp\"\n"
+    "\n"
+    "namespace ${_namespace} {\n"
+    "\n"
+    "/** @brief Typed endpoints of the interface ${_name}. */\n"
+    "struct ${_class_name} {\n"
+    "  /** @brief The interface name. */\n"
+    "  static constexpr std::string_view name{\"${_name}\"};\n"
+    "  /** @brief The interface major version. */\n"
+    "  static constexpr int32_t version_major{${_version_major}};\n"
+    "  /** @brief The interface minor version. */\n"
+    "  static constexpr int32_t version_minor{${_version_minor}};\n"
+    "${_members}"
+    "};\n"
+    "\n"
+    "}  // namespace ${_namespace}\n"
+    "\n"
+    "#endif  // ${_guard}\n"
+)
+# Keep the timestamp of an unchanged header, avoiding the rebuild of its dependents
+file(COPY_FILE "${ASTARTE_INTERFACE_HEADER}.tmp" "${ASTARTE_INTERFACE_HEADER}" ONLY_IF_DIFFERENT)
+file(REMOVE "${ASTARTE_INTERFACE_HEADER}.tmp")
@@ -104,6 +104,8 @@ file_patterns=(
     "private/"*.hpp
     "samples/"*/*.cpp
     "unit/"*.cpp
+    "benchmark/"*.cpp
+    "benchmark/"*.hpp
     "end_to_end/src/"*.cpp
     "end_to_end/include/"*.hpp
     "end_to_end/include/constants/"*.hpp
@@ -139,6 +141,7 @@ fi
 cmake_files=(
     "CMakeLists.txt"
     "unit/CMakeLists.txt"
+    "benchmark/CMakeLists.txt"
     "end_to_end/CMakeLists.txt"
     "samples/qt/CMakeLists.txt"
     "samples/simple/CMakeLists.txt"
@@ -0,0 +1,132 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_AWAITABLE_H
+#define ASTARTE_DEVICE_SDK_AWAITABLE_H
+
+/**
+ * @file astarte_device_sdk/awaitable.hpp
+ * @brief Awaitable results of the asynchronous operations, for use in C++20 coroutines.
+ */
+
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/** @brief Umbrella namespace for the Astarte device SDK */
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Executor used to resume the coroutines awaiting an operation.
+ * @details The executor is invoked with the suspended coroutine once the operation is completed,
+ * and should eventually call resume on it from one of its threads.
+ */
+using AstarteExecutor = std::function<void(std::coroutine_handle<>)>;
+
+/**
+ * @brief Tag selecting the awaitable overloads of the asynchronous functions.
+ * @details With an empty executor the awaiting coroutine is resumed on the thread completing the
+ * operation: the SDK completion thread for transmissions and the reception thread for received
+ * messages. Such coroutines should not block, as they would stall the SDK thread.
+ */
+struct AstarteUseAwaitable {
+  /** @brief Executor resuming the awaiting coroutine, might be empty. */
+  AstarteExecutor executor;
+};
+
+/** @brief Default awaitable tag, resuming the coroutines on the SDK threads. */
+inline const AstarteUseAwaitable use_awaitable{};
+
+/**
+ * @brief Result of an asynchronous operation that can be awaited with co_await.
+ * @details The awaitable should be awaited at most once. The operation runs independently from the
+ * awaitable, discarding it does not cancel the operation.
+ * @tparam T The type of the result of the operation.
+ */
+template <typename T>
+class AstarteAwaitable {
+ public:
+  /** @brief Shared state between the awaitable and the operation completing it. */
+  class State {
+   public:
+    /**
+     * @brief Construct a new state.
+     * @param executor The executor resuming the awaiting coroutine, might be empty.
+     */
+    explicit State(AstarteExecutor executor) : executor_(std::move(executor)) {}
+    /**
+     * @brief Store the result of the operation and resume the awaiting coroutine, if any.
+     * @param result The result of the operation.
+     */
+    void complete(T result) {
+      std::coroutine_handle<> continuation;
+      {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        result_.emplace(std::move(result));
+        continuation = std::exchange(continuation_, nullptr);
+      }
+      if (continuation) {
+        if (executor_) {
+          executor_(continuation);
+        } else {
+          continuation.resume();
+        }
+      }
+    }
+
+   private:
+    friend class AstarteAwaitable;
+
+    AstarteExecutor executor_;
+    std::mutex mutex_;
+    std::optional<T> result_;
+    std::coroutine_handle<> continuation_;
+  };
+
+  /**
+   * @brief Construct a new awaitable.
+   * @param state The state shared with the operation.
+   */
+  explicit AstarteAwaitable(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+  /**
+   * @brief Check if the operation has already been completed.
+   * @return True if the result is available and the coroutine should not be suspended.
+   */
+  auto await_ready() const -> bool {
+    const std::lock_guard<std::mutex> lock(state_->mutex_);
+    return state_->result_.has_value();
+  }
+  /**
+   * @brief Register the coroutine to resume once the operation is completed.
+   * @param handle The awaiting coroutine.
+   * @return False if the operation completed in the meantime and the coroutine should continue.
+   */
+  auto await_suspend(std::coroutine_handle<> handle) -> bool {
+    const std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->result_.has_value()) {
+      return false;
+    }
+    state_->continuation_ = handle;
+    return true;
+  }
+  /**
+   * @brief Get the result of the operation.
+   * @return The result, moved out of the awaitable.
+   */
+  auto await_resume() -> T {
+    const std::lock_guard<std::mutex> lock(state_->mutex_);
+    return std::move(state_->result_.value());
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_AWAITABLE_H
@@ -10,11 +10,15 @@
  * @brief Astarte data class and its related methods.
  */
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -36,9 +40,24 @@ concept AstarteDataAllowedType = requires {
                std::is_same_v<T, std::vector<std::chrono::system_clock::time_point>>;
 };
 
-/** @brief Astarte data class, representing the basic Astarte types. */
+/**
+ * @brief Astarte data class, representing the basic Astarte types.
+ * @details Scalar values are stored inline. Strings, binary blobs and arrays are stored in a
+ * reference counted allocation shared between the copies of an instance, so copies never
+ * duplicate the payload. The shared payload is immutable, moving the content out of an instance
+ * with into() && or take() moves it only when the instance is its sole owner, and copies it
+ * otherwise.
+ */
 class AstarteData {
  public:
+  /** @brief The variant holding the content of an Astarte data instance. */
+  using VariantType =
+      std::variant<int32_t, int64_t, double, bool, std::string, std::vector<uint8_t>,
+                   std::chrono::system_clock::time_point, std::vector<int32_t>,
+                   std::vector<int64_t>, std::vector<double>, std::vector<bool>,
+                   std::vector<std::string>, std::vector<std::vector<uint8_t>>,
+                   std::vector<std::chrono::system_clock::time_point>>;
+
   /**
    * @brief Constructor for the AstarteData class.
    * @note About string views. By design an AstarteData object is intended to encapsulate
@@ -50,9 +69,11 @@ class AstarteData {
   template <AstarteDataAllowedType T>
   explicit AstarteData(T value) {
     if constexpr (std::is_same_v<T, std::string_view>) {
-      data_ = std::string(value);
+      data_ = std::make_shared<VariantType>(std::in_place_type<std::string>, value);
+    } else if constexpr (is_inline_v<T>) {
+      data_.template emplace<VariantType>(std::in_place_type<T>, value);
     } else {
-      data_ = value;
+      data_ = std::make_shared<VariantType>(std::in_place_type<T>, std::move(value));
     }
   }
 
@@ -61,12 +82,31 @@ class AstarteData {
    * @return The value contained in the class instance.
    */
   template <AstarteDataAllowedType T>
-  [[nodiscard]] auto into() const
+  [[nodiscard]] auto into() const&
       -> std::conditional_t<std::is_same_v<T, std::string_view>, std::string_view, const T&> {
     if constexpr (std::is_same_v<T, std::string_view>) {
-      return std::string_view(std::get<std::string>(data_));
+      return std::string_view(std::get<std::string>(raw()));
     } else {
-      return std::get<T>(data_);
+      return std::get<T>(raw());
+    }
+  }
+  /**
+   * @brief Move the content out of the Astarte data class.
+   * @details The content of this instance is left in a valid but unspecified state. The content
+   * is copied if it's shared with other instances.
+   * @return The value contained in the class instance.
+   */
+  template <AstarteDataAllowedType T>
+    requires(!std::is_same_v<T, std::string_view>)
+  [[nodiscard]] auto into() && -> T {
+    if constexpr (is_inline_v<T>) {
+      return std::get<T>(raw());
+    } else {
+      auto& shared = std::get<Shared>(data_);
+      if (is_sole_owner(shared)) {
+        return std::get<T>(std::move(*shared));
+      }
+      return std::get<T>(*shared);
     }
   }
   /**
@@ -76,17 +116,37 @@ class AstarteData {
   template <AstarteDataAllowedType T>
   [[nodiscard]] auto try_into() const -> std::optional<T> {
     if constexpr (std::is_same_v<T, std::string_view>) {
-      if (std::holds_alternative<std::string>(data_)) {
-        return std::string_view(std::get<std::string>(data_));
+      if (const auto* value = std::get_if<std::string>(&raw())) {
+        return std::string_view(*value);
       }
     } else {
-      if (std::holds_alternative<T>(data_)) {
-        return std::get<T>(data_);
+      if (const auto* value = std::get_if<T>(&raw())) {
+        return *value;
       }
     }
 
     return std::nullopt;
   }
+  /**
+   * @brief Access the content of the Astarte data class in place, if it's of the given type.
+   * @details Equivalent to std::get_if on the variant returned by get_raw_data.
+   * @return A pointer to the value contained in the class instance, or nullptr for other types.
+   * The pointer is valid as long as this instance is neither modified nor destroyed.
+   */
+  template <AstarteDataAllowedType T>
+    requires(!std::is_same_v<T, std::string_view>)
+  [[nodiscard]] auto get_if() const -> const T* {
+    return std::get_if<T>(&raw());
+  }
+  /**
+   * @brief Invoke a visitor on the value contained in this class instance, without copying it.
+   * @param visitor A callable accepting a const reference to each of the possible data types.
+   * @return The value returned by the visitor.
+   */
+  template <typename Visitor>
+  auto visit(Visitor&& visitor) const -> decltype(auto) {
+    return std::visit(std::forward<Visitor>(visitor), raw());
+  }
   /**
    * @brief Get the type of the data contained in this class instance.
    * @return The type of the content of this class instance.
@@ -97,12 +157,15 @@ class AstarteData {
    * @return The raw data contained in this class instance. This is a variant containing one of the
    * possible data types.
    */
-  [[nodiscard]] auto get_raw_data() const
-      -> const std::variant<int32_t, int64_t, double, bool, std::string, std::vector<uint8_t>,
-                            std::chrono::system_clock::time_point, std::vector<int32_t>,
-                            std::vector<int64_t>, std::vector<double>, std::vector<bool>,
-                            std::vector<std::string>, std::vector<std::vector<uint8_t>>,
-                            std::vector<std::chrono::system_clock::time_point>>&;
+  [[nodiscard]] auto get_raw_data() const -> const VariantType&;
+  /**
+   * @brief Move the raw data out of this class instance.
+   * @details The content of this instance is left in a valid but unspecified state. The content
+   * is copied if it's shared with other instances.
+   * @return The raw data contained in this class instance. This is a variant containing one of the
+   * possible data types.
+   */
+  [[nodiscard]] auto take() && -> VariantType;
   /**
    * @brief Overloader for the comparison operator ==.
    * @param other The object to compare to.
@@ -117,12 +180,33 @@ class AstarteData {
   [[nodiscard]] auto operator!=(const AstarteData& other) const -> bool;
 
  private:
-  std::variant<int32_t, int64_t, double, bool, std::string, std::vector<uint8_t>,
-               std::chrono::system_clock::time_point, std::vector<int32_t>, std::vector<int64_t>,
-               std::vector<double>, std::vector<bool>, std::vector<std::string>,
-               std::vector<std::vector<uint8_t>>,
-               std::vector<std::chrono::system_clock::time_point>>
-      data_;
+  using Shared = std::shared_ptr<VariantType>;
+  template <typename T>
+  static constexpr bool is_inline_v =
+      std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> || std::is_same_v<T, double> ||
+      std::is_same_v<T, bool> || std::is_same_v<T, std::chrono::system_clock::time_point>;
+
+  [[nodiscard]] auto raw() const -> const VariantType& {
+    if (const auto* shared = std::get_if<Shared>(&data_)) {
+      return **shared;
+    }
+    return std::get<VariantType>(data_);
+  }
+
+  // True when this instance is the only owner of the payload, which can then be moved out. Other
+  // instances can't gain a reference without going through this one, so a count of one is final.
+  // The count is read with a relaxed load: the fence orders the accesses of the owners that
+  // released their copies, with a release decrement, before the move.
+  static auto is_sole_owner(const Shared& payload) -> bool {
+    if (payload.use_count() == 1) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return true;
+    }
+    return false;
+  }
+
+  // Scalars are held by the inline variant, all the other types by the shared one
+  std::variant<VariantType, Shared> data_;
 };
 
 }  // namespace AstarteDeviceSdk
@@ -0,0 +1,96 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_DATA_VIEW_H
+#define ASTARTE_DEVICE_SDK_DATA_VIEW_H
+
+/**
+ * @file astarte_device_sdk/data_view.hpp
+ * @brief Non-owning view over Astarte binary blobs and arrays.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Restricts the allowed element types for instances of an Astarte data view class.
+ * @details A span of uint8_t is a binary blob, while all other spans are arrays.
+ */
+template <typename T>
+concept AstarteDataViewAllowedType = requires {
+  requires std::is_same_v<T, uint8_t> || std::is_same_v<T, int32_t> ||
+               std::is_same_v<T, int64_t> || std::is_same_v<T, double> ||
+               std::is_same_v<T, bool> || std::is_same_v<T, std::string> ||
+               std::is_same_v<T, std::string_view> ||
+               std::is_same_v<T, std::vector<uint8_t>> ||
+               std::is_same_v<T, std::span<const uint8_t>> ||
+               std::is_same_v<T, std::chrono::system_clock::time_point>;
+};
+
+/**
+ * @brief Non-owning Astarte data class, representing binary blobs and arrays.
+ * @details Contrary to AstarteData, this class does not own its content. It can be used to send
+ * data residing in an existing buffer, without copying it into an intermediate vector. The
+ * referenced memory should outlive the instance of this class.
+ */
+class AstarteDataView {
+ public:
+  /** @brief Helper type for the variant of spans contained in the view. */
+  using VariantType =
+      std::variant<std::span<const uint8_t>, std::span<const int32_t>, std::span<const int64_t>,
+                   std::span<const double>, std::span<const bool>, std::span<const std::string>,
+                   std::span<const std::string_view>, std::span<const std::vector<uint8_t>>,
+                   std::span<const std::span<const uint8_t>>,
+                   std::span<const std::chrono::system_clock::time_point>>;
+
+  /**
+   * @brief Constructor for the AstarteDataView class.
+   * @param values The content of the Astarte data view instance.
+   */
+  template <AstarteDataViewAllowedType T>
+  explicit AstarteDataView(std::span<const T> values) : data_(values) {}
+  /**
+   * @brief Constructor for the AstarteDataView class, viewing the content of a vector.
+   * @param values The content of the Astarte data view instance.
+   */
+  template <AstarteDataViewAllowedType T>
+    requires(!std::is_same_v<T, bool>)
+  explicit AstarteDataView(const std::vector<T>& values)
+      : data_(std::span<const T>(values.data(), values.size())) {}
+
+  /**
+   * @brief Get the type of the data referenced by this class instance.
+   * @return The type of the content of this class instance.
+   */
+  [[nodiscard]] auto get_type() const -> AstarteType;
+  /**
+   * @brief Return the raw data referenced by this class instance.
+   * @return The raw data referenced by this class instance. This is a variant containing one of
+   * the possible span types.
+   */
+  [[nodiscard]] auto get_raw_data() const -> const VariantType&;
+  /**
+   * @brief Copy the referenced data into a new owning Astarte data instance.
+   * @return The new Astarte data instance.
+   */
+  [[nodiscard]] auto to_data() const -> AstarteData;
+
+ private:
+  VariantType data_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_DATA_VIEW_H
@@ -11,15 +11,21 @@
  */
 
 #include <chrono>
+#include <cstddef>
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/errors.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/series.hpp"
 
 /** @brief Umbrella namespace for the Astarte device SDK */
 namespace AstarteDeviceSdk {
@@ -101,6 +107,34 @@ class AstarteDevice {
                                const AstarteData& data,
                                const std::chrono::system_clock::time_point* timestamp)
       -> astarte_tl::expected<void, AstarteError> = 0;
+  /**
+   * @brief Send an individual data payload to Astarte, moving the payload.
+   * @details String payloads are moved into the transmitted message instead of being copied.
+   * The default implementation forwards to the overload taking a constant reference.
+   * @param interface_name The name of the target interface.
+   * @param path The specific endpoint path within the interface.
+   * @param data The data payload to send.
+   * @param timestamp An optional timestamp for the data point. If nullptr, Astarte will assign one.
+   * @return An error if generated.
+   */
+  virtual auto send_individual(std::string_view interface_name, std::string_view path,
+                               AstarteData&& data,
+                               const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send an individual binary blob or array payload to Astarte, without owning it.
+   * @details The viewed data is serialized directly from its buffer. The buffer only needs to
+   * outlive this call. The default implementation copies the viewed data into an AstarteData.
+   * @param interface_name The name of the target interface.
+   * @param path The specific endpoint path within the interface.
+   * @param data The view over the data payload to send.
+   * @param timestamp An optional timestamp for the data point. If nullptr, Astarte will assign one.
+   * @return An error if generated.
+   */
+  virtual auto send_individual(std::string_view interface_name, std::string_view path,
+                               const AstarteDataView& data,
+                               const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Send an aggregate object data payload to Astarte.
    * @param interface_name The name of the target interface.
@@ -113,6 +147,20 @@ class AstarteDevice {
                            const AstarteDatastreamObject& object,
                            const std::chrono::system_clock::time_point* timestamp)
       -> astarte_tl::expected<void, AstarteError> = 0;
+  /**
+   * @brief Send an aggregate object data payload to Astarte, moving the payload.
+   * @details String payloads are moved into the transmitted message instead of being copied.
+   * The default implementation forwards to the overload taking a constant reference.
+   * @param interface_name The name of the target interface.
+   * @param path The common base path for the data object.
+   * @param object The aggregate data object to send.
+   * @param timestamp An optional timestamp for the data. If nullptr, Astarte will assign one.
+   * @return An error if generated.
+   */
+  virtual auto send_object(std::string_view interface_name, std::string_view path,
+                           AstarteDatastreamObject&& object,
+                           const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Set a device property on Astarte.
    * @param interface_name The name of the interface containing the property.
@@ -123,6 +171,17 @@ class AstarteDevice {
   virtual auto set_property(std::string_view interface_name, std::string_view path,
                             const AstarteData& data)
       -> astarte_tl::expected<void, AstarteError> = 0;
+  /**
+   * @brief Set a device property on Astarte, moving the value.
+   * @details String payloads are moved into the transmitted message instead of being copied.
+   * The default implementation forwards to the overload taking a constant reference.
+   * @param interface_name The name of the interface containing the property.
+   * @param path The full path to the property.
+   * @param data The value to set for the property.
+   * @return An error if generated.
+   */
+  virtual auto set_property(std::string_view interface_name, std::string_view path,
+                            AstarteData&& data) -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Unset a device property on Astarte.
    * @param interface_name The name of the interface containing the property.
@@ -131,6 +190,29 @@ class AstarteDevice {
    */
   virtual auto unset_property(std::string_view interface_name, std::string_view path)
       -> astarte_tl::expected<void, AstarteError> = 0;
+  /**
+   * @brief Send multiple messages to Astarte in a single call.
+   * @details Each message is sent independently, a failure for one message does not prevent the
+   * transmission of the others. The default implementation sends the messages one at a time with
+   * send_individual, send_object, set_property and unset_property.
+   * @param messages The messages to send.
+   * @return A result for each message, in the same order as the input messages.
+   */
+  virtual auto send_batch(std::span<const AstarteOutgoingMessage> messages)
+      -> std::vector<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send a series of timestamped samples to an individual datastream endpoint.
+   * @details Each sample is transmitted as an individual datastream with its own timestamp. The
+   * transmission stops at the first failed sample. The default implementation sends the samples
+   * one at a time with send_individual.
+   * @param interface_name The name of the target interface.
+   * @param path The specific endpoint path within the interface.
+   * @param series The samples to send.
+   * @return A result for each sample, in the same order as the samples of the series.
+   */
+  virtual auto send_series(std::string_view interface_name, std::string_view path,
+                           const AstarteDatastreamSeries& series)
+      -> std::vector<astarte_tl::expected<void, AstarteError>>;
   /**
    * @brief Poll for incoming messages from Astarte.
    * @param timeout The maximum time to block waiting for a message.
@@ -139,6 +221,17 @@ class AstarteDevice {
    */
   virtual auto poll_incoming(const std::chrono::milliseconds& timeout)
       -> std::optional<AstarteMessage> = 0;
+  /**
+   * @brief Poll for a batch of incoming messages from Astarte.
+   * @details All the messages already received, up to max, are retrieved at once. The default
+   * implementation retrieves the messages one at a time with poll_incoming.
+   * @param out The vector where the received messages are appended.
+   * @param max The maximum number of messages to retrieve.
+   * @param timeout The maximum time to block waiting for the first message.
+   * @return The number of messages appended to out, zero if the timeout was reached.
+   */
+  virtual auto poll_incoming_batch(std::vector<AstarteMessage>& out, std::size_t max,
+                                   std::chrono::milliseconds timeout) -> std::size_t;
 
  protected:
   /**
@@ -11,20 +11,35 @@
  */
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <future>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
+#include "astarte_device_sdk/awaitable.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/device.hpp"
+#include "astarte_device_sdk/endpoint_handle.hpp"
 #include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/message_consumer.hpp"
+#include "astarte_device_sdk/message_handler.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/reception_queue.hpp"
+#include "astarte_device_sdk/series.hpp"
+#include "astarte_device_sdk/store_forward.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
 
 /** @brief Umbrella namespace for the Astarte device SDK */
@@ -92,6 +107,52 @@ class AstarteDeviceGrpc : public AstarteDevice {
    * @return An error if generated.
    */
   auto disconnect() -> astarte_tl::expected<void, AstarteError> override;
+  /**
+   * @brief Enable the outbound queue.
+   * @details Once enabled, send_individual, send_object, set_property and unset_property return
+   * as soon as the message has been queued. A dedicated thread transmits the queued messages to
+   * the message hub, retaining them while the device is disconnected. Datastreams failing to be
+   * transmitted are stored by the store and forward buffer, when enabled and allowed by the
+   * retention of their mapping, other failed messages are counted by get_failed_messages. With a
+   * full queue, a message discarded by the kDropNewest policy is not reported to the caller, while
+   * the kFail policy returns an error. The batch, series and asynchronous send functions bypass the
+   * queue, their messages might be transmitted before previously queued ones. This function should
+   * be called while the device is disconnected.
+   * @param capacity The maximum number of messages stored in the queue.
+   * @param policy The policy to apply when sending with a full queue.
+   * @return An error if generated.
+   */
+  auto set_outbound_queue(std::size_t capacity, AstarteOverflowPolicy policy)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Get the number of queued messages lost because their transmission failed.
+   * @details Messages stored by the store and forward buffer after a failure are not counted.
+   * @return The number of failed messages of the outbound queue.
+   */
+  auto get_failed_messages() -> std::uint64_t;
+  /**
+   * @brief Enable the store and forward buffer.
+   * @details Once enabled, datastreams sent while the device is disconnected are buffered
+   * according to the retention of their mapping instead of being refused. Mappings with discard
+   * retention are not buffered. Buffered data is replayed in order, at a limited rate, once the
+   * device reconnects. Data sent after the reconnection is transmitted directly, without waiting
+   * for the replay, so it might reach the message hub before older buffered data.
+   * This function should be called while the device is disconnected.
+   * @param config The store and forward configuration.
+   * @return An error if generated.
+   */
+  auto set_store_and_forward(const AstarteStoreForwardConfig& config)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Prepare a handle for repeated transmissions to the same endpoint.
+   * @details The interface should have already been added to the device and be owned by the
+   * device. The path should match one of the interface mappings.
+   * @param interface_name The name of the interface of the endpoint.
+   * @param path The path of the endpoint.
+   * @return The endpoint handle or an error if the endpoint is not valid.
+   */
+  auto prepare(std::string_view interface_name, std::string_view path)
+      -> astarte_tl::expected<AstarteEndpointHandle, AstarteError>;
   /**
    * @brief Send individual data to Astarte.
    * @param interface_name The name of the interface on which to send the data.
@@ -104,6 +165,29 @@ class AstarteDeviceGrpc : public AstarteDevice {
                        const AstarteData& data,
                        const std::chrono::system_clock::time_point* timestamp)
       -> astarte_tl::expected<void, AstarteError> override;
+  /**
+   * @brief Send individual data to Astarte, moving string payloads into the message.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param data The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_individual(std::string_view interface_name, std::string_view path, AstarteData&& data,
+                       const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError> override;
+  /**
+   * @brief Send individual data to Astarte, serializing it directly from a non-owned buffer.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param data The view over the data to send, it only needs to outlive this call.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_individual(std::string_view interface_name, std::string_view path,
+                       const AstarteDataView& data,
+                       const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError> override;
   /**
    * @brief Send object data to Astarte.
    * @param interface_name The name of the interface on which to send the data.
@@ -116,6 +200,18 @@ class AstarteDeviceGrpc : public AstarteDevice {
                    const AstarteDatastreamObject& object,
                    const std::chrono::system_clock::time_point* timestamp)
       -> astarte_tl::expected<void, AstarteError> override;
+  /**
+   * @brief Send object data to Astarte, moving string payloads into the message.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The common path to the interface endpoint to use for sending.
+   * @param object The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_object(std::string_view interface_name, std::string_view path,
+                   AstarteDatastreamObject&& object,
+                   const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError> override;
   /**
    * @brief Set a device property.
    * @param interface_name The name of the interface for the property.
@@ -125,6 +221,15 @@ class AstarteDeviceGrpc : public AstarteDevice {
    */
   auto set_property(std::string_view interface_name, std::string_view path, const AstarteData& data)
       -> astarte_tl::expected<void, AstarteError> override;
+  /**
+   * @brief Set a device property, moving string payloads into the message.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @param data The property data.
+   * @return An error if generated.
+   */
+  auto set_property(std::string_view interface_name, std::string_view path, AstarteData&& data)
+      -> astarte_tl::expected<void, AstarteError> override;
   /**
    * @brief Unset a device property.
    * @param interface_name The name of the interface for the property.
@@ -133,13 +238,272 @@ class AstarteDeviceGrpc : public AstarteDevice {
    */
   auto unset_property(std::string_view interface_name, std::string_view path)
       -> astarte_tl::expected<void, AstarteError> override;
+  /**
+   * @brief Send multiple messages to Astarte in a single call.
+   * @details The messages are pipelined toward the message hub, the function returns once all
+   * of them have been acknowledged or have failed.
+   * @note The function blocks until the transmissions complete, which happens on the thread
+   * resuming the awaitable functions with use_awaitable. Calling it from a coroutine resumed on
+   * that thread would never return, every message is refused instead.
+   * @param messages The messages to send.
+   * @return A result for each message, in the same order as the input messages.
+   */
+  auto send_batch(std::span<const AstarteOutgoingMessage> messages)
+      -> std::vector<astarte_tl::expected<void, AstarteError>> override;
+  /**
+   * @brief Send a series of timestamped samples to an individual datastream endpoint.
+   * @details The interface, path and type of the series are validated once, then the samples are
+   * written one after the other into a single reused message and pipelined toward the message
+   * hub, in order. No sample is submitted after the first failure, the function returns once all
+   * the submitted samples have been acknowledged or have failed.
+   * @note As for send_batch, the samples are refused when sent from the thread resuming the
+   * awaitable functions with use_awaitable.
+   * @param interface_name The name of the interface on which to send the samples.
+   * @param path The path on the interface on which to send the samples.
+   * @param series The samples to send, with a timestamp for each value.
+   * @return A result for each sample, in the same order as the samples of the series. Samples not
+   * submitted after a failure hold an AstarteOperationRefusedError.
+   */
+  auto send_series(std::string_view interface_name, std::string_view path,
+                   const AstarteDatastreamSeries& series)
+      -> std::vector<astarte_tl::expected<void, AstarteError>> override;
+  /**
+   * @brief Send individual data to Astarte without waiting for the message hub response.
+   * @details The returned future becomes ready once the message hub has acknowledged the message.
+   * Multiple asynchronous sends can be in flight at the same time.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param data The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return A future holding an error if generated.
+   */
+  auto send_individual_async(std::string_view interface_name, std::string_view path,
+                             const AstarteData& data,
+                             const std::chrono::system_clock::time_point* timestamp)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send object data to Astarte without waiting for the message hub response.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The common path to the interface endpoint to use for sending.
+   * @param object The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return A future holding an error if generated.
+   */
+  auto send_object_async(std::string_view interface_name, std::string_view path,
+                         const AstarteDatastreamObject& object,
+                         const std::chrono::system_clock::time_point* timestamp)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Set a device property without waiting for the message hub response.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @param data The property data.
+   * @return A future holding an error if generated.
+   */
+  auto set_property_async(std::string_view interface_name, std::string_view path,
+                          const AstarteData& data)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Unset a device property without waiting for the message hub response.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @return A future holding an error if generated.
+   */
+  auto unset_property_async(std::string_view interface_name, std::string_view path)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send individual data to Astarte, returning an awaitable for C++20 coroutines.
+   * @details The awaiting coroutine is resumed once the message hub has acknowledged the message,
+   * on the executor of the token or on the SDK completion thread.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param data The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @param token The awaitable tag, use_awaitable or a tag holding an executor.
+   * @return An awaitable holding an error if generated.
+   */
+  auto send_individual_async(std::string_view interface_name, std::string_view path,
+                             const AstarteData& data,
+                             const std::chrono::system_clock::time_point* timestamp,
+                             const AstarteUseAwaitable& token)
+      -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send object data to Astarte, returning an awaitable for C++20 coroutines.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The common path to the interface endpoint to use for sending.
+   * @param object The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @param token The awaitable tag, use_awaitable or a tag holding an executor.
+   * @return An awaitable holding an error if generated.
+   */
+  auto send_object_async(std::string_view interface_name, std::string_view path,
+                         const AstarteDatastreamObject& object,
+                         const std::chrono::system_clock::time_point* timestamp,
+                         const AstarteUseAwaitable& token)
+      -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Set a device property, returning an awaitable for C++20 coroutines.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @param data The property data.
+   * @param token The awaitable tag, use_awaitable or a tag holding an executor.
+   * @return An awaitable holding an error if generated.
+   */
+  auto set_property_async(std::string_view interface_name, std::string_view path,
+                          const AstarteData& data, const AstarteUseAwaitable& token)
+      -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Unset a device property, returning an awaitable for C++20 coroutines.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @param token The awaitable tag, use_awaitable or a tag holding an executor.
+   * @return An awaitable holding an error if generated.
+   */
+  auto unset_property_async(std::string_view interface_name, std::string_view path,
+                            const AstarteUseAwaitable& token)
+      -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Wait for the next received message in a C++20 coroutine.
+   * @details The awaitable is ready immediately if a message is already queued. Otherwise the
+   * awaiting coroutine is resumed when a message arrives, on the executor of the token or on the
+   * SDK reception thread. Multiple coroutines can wait at the same time and are served in order.
+   * Should not be used together with poll_incoming or a message handler, pending waits fail when
+   * the device is destroyed.
+   * @param token The awaitable tag, use_awaitable or a tag holding an executor.
+   * @return An awaitable holding the received message or an error if generated.
+   */
+  auto next_message(const AstarteUseAwaitable& token = use_awaitable)
+      -> AstarteAwaitable<astarte_tl::expected<AstarteMessage, AstarteError>>;
   /**
    * @brief Poll incoming messages.
+   * @details Can be called from multiple threads, unless the single consumer reception queue is
+   * selected, see set_reception_queue. Not supported by the multicast reception queue,
+   * std::nullopt is returned immediately.
    * @param timeout Will block for this timeout if no message is present.
    * @return The received message when present, std::nullopt otherwise.
    */
   auto poll_incoming(const std::chrono::milliseconds& timeout)
       -> std::optional<AstarteMessage> override;
+  /**
+   * @brief Poll a batch of incoming messages.
+   * @details Can be called from multiple threads, unless the single consumer reception queue is
+   * selected, see set_reception_queue. Not supported by the multicast reception queue, zero is
+   * returned immediately.
+   * @param out The vector where the received messages are appended.
+   * @param max The maximum number of messages to retrieve.
+   * @param timeout Will block for this timeout if no message is present.
+   * @return The number of messages appended to out.
+   */
+  auto poll_incoming_batch(std::vector<AstarteMessage>& out, std::size_t max,
+                           std::chrono::milliseconds timeout) -> std::size_t override;
+  /**
+   * @brief Get a file descriptor that is readable while received messages are available.
+   * @details The file descriptor can be monitored by an event loop (epoll, libuv, Qt's
+   * QSocketNotifier) together with the other descriptors of the application. Once it becomes
+   * readable, messages should be retrieved with poll_incoming or poll_incoming_batch, without
+   * reading from the descriptor, until the queue is empty. The descriptor is then reset by the
+   * device. Spurious wakeups are possible. The descriptor is owned by the device and should not be
+   * closed. This function is only supported on POSIX platforms and is refused while the multicast
+   * reception queue is used.
+   * @return The file descriptor or an error if generated.
+   */
+  auto native_handle() -> astarte_tl::expected<int, AstarteError>;
+  /**
+   * @brief Set a handler invoked for each message received from Astarte.
+   * @details The handler is invoked by a pool of dispatcher threads managed by the device, as soon
+   * as a message is received. With more than one worker, messages may be handled concurrently and
+   * out of order, and a multi consumer reception queue is required, see set_reception_queue. While
+   * a handler is set, poll_incoming should not be used. An empty handler stops the dispatcher,
+   * restoring the polling behaviour, unless subscriptions are present, see subscribe. Handlers may
+   * call this function, subscribe and unsubscribe: the change applies to the following messages,
+   * while the calling handler runs to completion. Handlers must not destroy the device nor call
+   * set_reception_queue.
+   * @param handler The handler to invoke for each message.
+   * @param workers The number of dispatcher threads, should be greater than zero.
+   * @return An error if generated.
+   */
+  auto set_message_handler(AstarteMessageHandler handler, std::size_t workers = 1)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Subscribe a handler to the messages of an interface with a path matching a pattern.
+   * @details The pattern is split in segments and supports the Astarte parametric segments, e.g.
+   * "/%{sensor_id}/value", each matching any non-empty segment of the path. For aggregated objects
+   * the pattern is matched against the common path of the object. Subscriptions are compiled into
+   * a trie, so routing a message costs a lookup per path segment regardless of the number of
+   * subscriptions. Handlers are invoked by the dispatcher threads, see set_message_handler, that
+   * are started by the first subscription. A message matching multiple subscriptions is passed to
+   * all of them, messages matching none are passed to the message handler, if any, and discarded
+   * otherwise. Subscriptions can be added and removed from within a handler.
+   * @param interface_name The name of the interface of the messages.
+   * @param path_pattern The pattern of the paths of the messages.
+   * @param handler The handler to invoke for the matching messages.
+   * @return The identifier of the subscription, or an error if the pattern is invalid.
+   */
+  auto subscribe(std::string_view interface_name, std::string_view path_pattern,
+                 AstarteMessageHandler handler)
+      -> astarte_tl::expected<AstarteSubscriptionId, AstarteError>;
+  /**
+   * @brief Remove a subscription.
+   * @details The dispatcher threads keep running, they are stopped by setting an empty message
+   * handler once no subscriptions are left.
+   * @param subscription The identifier returned by subscribe.
+   * @return An error if generated.
+   */
+  auto unsubscribe(AstarteSubscriptionId subscription) -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Set the implementation and capacity of the queue holding the received messages.
+   * @details The default queue is protected by a mutex and supports multiple consumers. The
+   * lock-free single consumer queue reduces the reception overhead, but poll_incoming,
+   * poll_incoming_batch and next_message must then be called by a single thread at a time, and a
+   * single dispatcher worker can be used. When a bounded queue is full the overflow policy is
+   * applied to the received messages. With the kBlock policy the device stops reading from the
+   * message hub until space is available, letting the gRPC flow control slow down the message hub.
+   * The kDropNewest policy discards the received message, the kDropOldest policy, not supported by
+   * the single consumer queue, discards the oldest message in the queue. The kFail policy is not
+   * supported. The conflating queue keeps only the latest value of each pending property. The
+   * multicast queue delivers each message to all the consumers created with add_message_consumer,
+   * using the capacity and policy for the buffer of each consumer. See add_message_consumer for
+   * the functions not supported by the multicast queue. The queue can only be set before the
+   * device is first connected and before any function receiving messages is used, such as
+   * poll_incoming, next_message, native_handle, set_message_handler, subscribe or
+   * add_message_consumer. It's refused afterwards.
+   * @param type The implementation of the queue.
+   * @param capacity The maximum number of messages in the queue, zero for an unbounded queue.
+   * @param policy The policy to apply when a message is received with a full queue.
+   * @return An error if generated.
+   */
+  auto set_reception_queue(AstarteReceptionQueue type, std::size_t capacity = 0,
+                           AstarteOverflowPolicy policy = AstarteOverflowPolicy::kBlock)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Get the number of received messages dropped because of a full reception queue.
+   * @return The number of dropped messages.
+   */
+  auto get_dropped_messages() -> std::uint64_t;
+  /**
+   * @brief Set the number of threads converting the events received from the message hub.
+   * @details By default events are converted on the thread reading the gRPC stream, so a large
+   * object or array delays the read of the next event. With one or more decode workers the reader
+   * thread only reads the raw events, handing them over to the workers. Messages with the same
+   * interface and path are converted by the same worker and are published to the reception queue
+   * in the order they were received, while messages with different interfaces or paths may be
+   * published out of order. This function should be called while the device is disconnected.
+   * @param workers The number of decode workers, zero to convert on the reader thread.
+   * @return An error if generated.
+   */
+  auto set_decode_workers(std::size_t workers) -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Add an independent consumer of the received messages.
+   * @details Requires the multicast reception queue, see set_reception_queue, and can be called
+   * while connected. The consumer receives all the messages received from now on, each message is
+   * decoded once and shared between all the consumers. With the kBlock policy a consumer with a
+   * full buffer stops the reception for all the others. Consumers are the only way to receive the
+   * messages while the multicast queue is used: next_message, native_handle, message handlers and
+   * subscriptions are refused, while poll_incoming and poll_incoming_batch return immediately
+   * without a message.
+   * @return The consumer or an error if generated.
+   */
+  auto add_message_consumer() -> astarte_tl::expected<AstarteMessageConsumer, AstarteError>;
   /**
    * @brief Get all stored properties matching the input filter.
    * @param ownership Optional ownership filter.
@@ -164,6 +528,7 @@ class AstarteDeviceGrpc : public AstarteDevice {
       -> astarte_tl::expected<AstartePropertyIndividual, AstarteError>;
 
  private:
+  friend class AstarteEndpointHandle;
   struct AstarteDeviceGrpcImpl;
   std::shared_ptr<AstarteDeviceGrpcImpl> astarte_device_impl_;
 };
@@ -0,0 +1,110 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_ENDPOINT_HANDLE_H
+#define ASTARTE_DEVICE_SDK_ENDPOINT_HANDLE_H
+
+/**
+ * @file astarte_device_sdk/endpoint_handle.hpp
+ * @brief Prepared handle for repeated transmissions to the same interface endpoint.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/object.hpp"
+
+namespace AstarteDeviceSdk {
+
+class AstarteDeviceGrpc;
+
+/**
+ * @brief Handle to an interface endpoint, prepared for repeated transmissions.
+ * @details Handles are obtained from AstarteDeviceGrpc::prepare. The endpoint is validated when
+ * the handle is created, and again only after an interface has been added to or removed from the
+ * device: once its interface is removed the transmissions fail. The interface name and path are
+ * stored in cached messages reused by the transmissions. Copies of a handle share the cached
+ * messages, concurrent transmissions through them each use their own. A handle can outlive its
+ * device, in which case all transmissions will fail.
+ */
+class AstarteEndpointHandle {
+ public:
+  /**
+   * @brief Get the interface name of the endpoint.
+   * @return The interface name.
+   */
+  [[nodiscard]] auto get_interface() const -> const std::string&;
+  /**
+   * @brief Get the path of the endpoint.
+   * @return The path.
+   */
+  [[nodiscard]] auto get_path() const -> const std::string&;
+  /**
+   * @brief Send individual data to the endpoint.
+   * @param data The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_individual(const AstarteData& data,
+                       const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send individual data to the endpoint, moving string payloads into the message.
+   * @param data The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_individual(AstarteData&& data,
+                       const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send individual data to the endpoint, serializing it directly from a non-owned buffer.
+   * @param data The view over the data to send, it only needs to outlive this call.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_individual(const AstarteDataView& data,
+                       const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send object data to the endpoint.
+   * @param object The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send_object(const AstarteDatastreamObject& object,
+                   const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Set the property of the endpoint.
+   * @param data The property data.
+   * @return An error if generated.
+   */
+  auto set_property(const AstarteData& data) const -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Unset the property of the endpoint.
+   * @return An error if generated.
+   */
+  auto unset_property() const -> astarte_tl::expected<void, AstarteError>;
+
+ private:
+  friend class AstarteDeviceGrpc;
+  struct AstarteEndpointHandleImpl;
+
+  explicit AstarteEndpointHandle(std::shared_ptr<AstarteEndpointHandleImpl> impl);
+  template <typename Fill>
+  auto send_with(bool datastream, bool object, Fill&& fill) const
+      -> astarte_tl::expected<void, AstarteError>;
+
+  std::shared_ptr<AstarteEndpointHandleImpl> endpoint_handle_impl_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_ENDPOINT_HANDLE_H
@@ -178,39 +178,23 @@ struct astarte_fmt::formatter<AstarteDeviceSdk::AstarteData> {
   auto format(const AstarteDeviceSdk::AstarteData& data, FormatContext& ctx) const {
     auto out = ctx.out();
 
-    if (std::holds_alternative<int32_t>(data.get_raw_data())) {
-      out = astarte_fmt::format_to(out, "{}", std::get<int32_t>(data.get_raw_data()));
-    } else if (std::holds_alternative<int64_t>(data.get_raw_data())) {
-      out = astarte_fmt::format_to(out, "{}", std::get<int64_t>(data.get_raw_data()));
-    } else if (std::holds_alternative<double>(data.get_raw_data())) {
-      out = astarte_fmt::format_to(out, "{}", std::get<double>(data.get_raw_data()));
-    } else if (std::holds_alternative<bool>(data.get_raw_data())) {
-      auto s = (std::get<bool>(data.get_raw_data()) ? "true" : "false");
-      out = astarte_fmt::format_to(out, "{}", s);
-    } else if (std::holds_alternative<std::string>(data.get_raw_data())) {
-      out = astarte_fmt::format_to(out, R"("{}")", std::get<std::string>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<uint8_t>>(data.get_raw_data())) {
-      utils::format_base64(out, std::get<std::vector<uint8_t>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::chrono::system_clock::time_point>(data.get_raw_data())) {
-      utils::format_timestamp(out,
-                              std::get<std::chrono::system_clock::time_point>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<int32_t>>(data.get_raw_data())) {
-      utils::format_vector(out, std::get<std::vector<int32_t>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<int64_t>>(data.get_raw_data())) {
-      utils::format_vector(out, std::get<std::vector<int64_t>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<double>>(data.get_raw_data())) {
-      utils::format_vector(out, std::get<std::vector<double>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<bool>>(data.get_raw_data())) {
-      utils::format_vector(out, std::get<std::vector<bool>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<std::string>>(data.get_raw_data())) {
-      utils::format_vector(out, std::get<std::vector<std::string>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<std::vector<uint8_t>>>(data.get_raw_data())) {
-      utils::format_vector(out, std::get<std::vector<std::vector<uint8_t>>>(data.get_raw_data()));
-    } else if (std::holds_alternative<std::vector<std::chrono::system_clock::time_point>>(
-                   data.get_raw_data())) {
-      utils::format_vector(
-          out, std::get<std::vector<std::chrono::system_clock::time_point>>(data.get_raw_data()));
-    }
+    // The content is visited in place, avoiding a copy of large payloads
+    data.visit([&out](const auto& value) {
+      using T = std::decay_t<decltype(value)>;
+      if constexpr (std::is_same_v<T, bool>) {
+        out = astarte_fmt::format_to(out, "{}", (value ? "true" : "false"));
+      } else if constexpr (std::is_same_v<T, std::string>) {
+        out = astarte_fmt::format_to(out, R"("{}")", value);
+      } else if constexpr (std::is_same_v<T, std::vector<uint8_t>>) {
+        utils::format_base64(out, value);
+      } else if constexpr (std::is_same_v<T, std::chrono::system_clock::time_point>) {
+        utils::format_timestamp(out, value);
+      } else if constexpr (std::is_arithmetic_v<T>) {
+        out = astarte_fmt::format_to(out, "{}", value);
+      } else {
+        utils::format_vector(out, value);
+      }
+    });
 
     return out;
   }
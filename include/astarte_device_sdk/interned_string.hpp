@@ -0,0 +1,92 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_INTERNED_STRING_H
+#define ASTARTE_DEVICE_SDK_INTERNED_STRING_H
+
+/**
+ * @file astarte_device_sdk/interned_string.hpp
+ * @brief Handle to interface names and paths shared between messages.
+ */
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Immutable string, shared with all the copies of the handle.
+ * @details Messages received for a registered interface share the interface name and the non
+ * parametric paths held by the interface, so that they are compared by address and copied without
+ * allocations. Other strings are owned by the handle and its copies.
+ */
+class AstarteInternedString {
+ public:
+  /** @brief Construct an empty string. */
+  AstarteInternedString() = default;
+  /**
+   * @brief Construct a handle owning a copy of the string.
+   * @param str The string to reference.
+   */
+  explicit AstarteInternedString(std::string_view str);
+  /**
+   * @brief Construct a handle taking ownership of the string.
+   * @param str The string to reference.
+   */
+  explicit AstarteInternedString(std::string&& str);
+  /**
+   * @brief Construct a handle owning a copy of the string.
+   * @param str The null terminated string to reference.
+   */
+  explicit AstarteInternedString(const char* str) : AstarteInternedString(std::string_view(str)) {}
+  /**
+   * @brief Construct a handle sharing an existing string.
+   * @param shared The string to share, must not be null.
+   */
+  explicit AstarteInternedString(std::shared_ptr<const std::string> shared)
+      : str_(std::move(shared)) {}
+
+  /**
+   * @brief Get the referenced string.
+   * @return A reference to the string, stable for the lifetime of the handle.
+   */
+  [[nodiscard]] auto get() const -> const std::string& {
+    return (str_ != nullptr) ? *str_ : empty_;
+  }
+  /**
+   * @brief Check if two handles share the same string.
+   * @param other The handle to compare to.
+   * @return True if both handles reference the same copy of the string.
+   */
+  [[nodiscard]] auto shares(const AstarteInternedString& other) const -> bool {
+    return (str_ != nullptr) && (str_ == other.str_);
+  }
+  /**
+   * @brief Overloader for the comparison operator ==.
+   * @details Handles sharing the same string are compared in constant time.
+   * @param other The object to compare to.
+   * @return True when equal, false otherwise.
+   */
+  [[nodiscard]] auto operator==(const AstarteInternedString& other) const -> bool {
+    return (str_ == other.str_) || (get() == other.get());
+  }
+  /**
+   * @brief Overloader for the comparison operator != .
+   * @param other The object to compare to.
+   * @return True when different, false otherwise.
+   */
+  [[nodiscard]] auto operator!=(const AstarteInternedString& other) const -> bool {
+    return !(*this == other);
+  }
+
+ private:
+  inline static const std::string empty_;
+  std::shared_ptr<const std::string> str_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_INTERNED_STRING_H
@@ -0,0 +1,67 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_MESSAGE_CONSUMER_H
+#define ASTARTE_DEVICE_SDK_MESSAGE_CONSUMER_H
+
+/**
+ * @file astarte_device_sdk/message_consumer.hpp
+ * @brief Independent consumer of the messages received by a device in multicast mode.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "astarte_device_sdk/msg.hpp"
+
+namespace AstarteDeviceSdk {
+
+class AstarteDeviceGrpc;
+
+/**
+ * @brief Consumer of the messages received by a device with a multicast reception queue.
+ * @details Consumers are obtained from AstarteDeviceGrpc::add_message_consumer. Each consumer has
+ * its own bounded buffer and receives every message received after its creation. Messages are
+ * decoded once and shared, immutable, between all the consumers. Copies of a consumer share the
+ * same buffer. The consumer is removed from the device once all its copies are destroyed, and can
+ * outlive its device, in which case no more messages are received.
+ */
+class AstarteMessageConsumer {
+ public:
+  /**
+   * @brief Poll the next message of this consumer.
+   * @param timeout Will block for this timeout if no message is present.
+   * @return The received message when present, a nullptr otherwise.
+   */
+  auto poll(const std::chrono::milliseconds& timeout) -> std::shared_ptr<const AstarteMessage>;
+  /**
+   * @brief Poll a batch of messages of this consumer.
+   * @param out The vector where the received messages are appended.
+   * @param max The maximum number of messages to retrieve.
+   * @param timeout Will block for this timeout if no message is present.
+   * @return The number of messages appended to out.
+   */
+  auto poll_batch(std::vector<std::shared_ptr<const AstarteMessage>>& out, std::size_t max,
+                  std::chrono::milliseconds timeout) -> std::size_t;
+  /**
+   * @brief Get the number of messages dropped because the buffer of this consumer was full.
+   * @return The number of dropped messages.
+   */
+  auto get_dropped_messages() -> std::uint64_t;
+
+ private:
+  friend class AstarteDeviceGrpc;
+  struct AstarteMessageConsumerImpl;
+
+  explicit AstarteMessageConsumer(std::shared_ptr<AstarteMessageConsumerImpl> impl);
+
+  std::shared_ptr<AstarteMessageConsumerImpl> message_consumer_impl_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_MESSAGE_CONSUMER_H
@@ -0,0 +1,31 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_MESSAGE_HANDLER_H
+#define ASTARTE_DEVICE_SDK_MESSAGE_HANDLER_H
+
+/**
+ * @file astarte_device_sdk/message_handler.hpp
+ * @brief Callbacks invoked by the device for the messages received from Astarte.
+ */
+
+#include <cstdint>
+#include <functional>
+
+#include "astarte_device_sdk/msg.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Callback invoked for each message received from Astarte.
+ * @details The callback is invoked from one of the dispatcher threads of the device.
+ */
+using AstarteMessageHandler = std::function<void(const AstarteMessage&)>;
+
+/** @brief Identifier of a subscription to the messages of an interface and path pattern. */
+using AstarteSubscriptionId = std::uint64_t;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_MESSAGE_HANDLER_H
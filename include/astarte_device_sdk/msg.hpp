@@ -13,15 +13,22 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 
 #include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/interned_string.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/property.hpp"
 
 namespace AstarteDeviceSdk {
 
-/** @brief Astarte message class, represents a full message for/from Astarte. */
+/**
+ * @brief Astarte message class, represents a full message for/from Astarte.
+ * @details Messages received for a registered interface share the interface name and the non
+ * parametric paths held by the SDK, copies of a message share its strings.
+ */
 class AstarteMessage {
  public:
   /**
@@ -32,7 +39,26 @@ class AstarteMessage {
    */
   template <typename T>
   AstarteMessage(std::string_view interface, std::string_view path, T data)
-      : interface_(interface), path_(path), data_(data) {}
+      : interface_(interface), path_(path), data_(std::move(data)) {}
+  /**
+   * @brief Constructor for the AstarteMessage class, taking ownership of the strings.
+   * @param interface The interface for the message.
+   * @param path The path for the message.
+   * @param data The data for the message.
+   */
+  template <typename S, typename T>
+    requires std::is_same_v<S, std::string>
+  AstarteMessage(S&& interface, S&& path, T data)
+      : interface_(std::move(interface)), path_(std::move(path)), data_(std::move(data)) {}
+  /**
+   * @brief Constructor for the AstarteMessage class, sharing the handles to the strings.
+   * @param interface The interface for the message.
+   * @param path The path for the message.
+   * @param data The data for the message.
+   */
+  template <typename T>
+  AstarteMessage(AstarteInternedString interface, AstarteInternedString path, T data)
+      : interface_(std::move(interface)), path_(std::move(path)), data_(std::move(data)) {}
 
   /**
    * @brief Get the interface of the message.
@@ -44,6 +70,17 @@ class AstarteMessage {
    * @return The path.
    */
   [[nodiscard]] auto get_path() const -> const std::string&;
+  /**
+   * @brief Get the handle to the interface of the message.
+   * @details Handles to the interfaces registered in the SDK are compared in constant time.
+   * @return The interface handle.
+   */
+  [[nodiscard]] auto get_interface_handle() const -> const AstarteInternedString&;
+  /**
+   * @brief Get the handle to the path of the message.
+   * @return The path handle.
+   */
+  [[nodiscard]] auto get_path_handle() const -> const AstarteInternedString&;
   /**
    * @brief Check if this message contains a datastream.
    * @return True if the message contains a datastream, false otherwise.
@@ -95,8 +132,8 @@ class AstarteMessage {
   [[nodiscard]] auto operator!=(const AstarteMessage& other) const -> bool;
 
  private:
-  std::string interface_;
-  std::string path_;
+  AstarteInternedString interface_;
+  AstarteInternedString path_;
   std::variant<AstarteDatastreamIndividual, AstarteDatastreamObject, AstartePropertyIndividual>
       data_;
 };
@@ -10,27 +10,145 @@
  * @brief Astarte object class and its related methods.
  */
 
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "astarte_device_sdk/data.hpp"
 
 namespace AstarteDeviceSdk {
 
-/** @brief Astarte object class, representing the Astarte object datastream data. */
+/**
+ * @brief Astarte object class, representing the Astarte object datastream data.
+ * @details Elements are stored contiguously, sorted by path, so building a reserved object costs a
+ * single allocation and lookups accept any string view without building a std::string.
+ */
 class AstarteDatastreamObject {
  public:
-  /** @brief Helper type for the map of paths and Astarte datas. */
-  using MapType = std::unordered_map<std::string, AstarteData>;
-  /** @brief Helper type for the iterator over the map of paths and Astarte datas. */
-  using iterator = MapType::iterator;
-  /** @brief Helper type for the const iterator over the map of paths and Astarte datas. */
-  using const_iterator = MapType::const_iterator;
+  /** @brief Helper type for the sorted vector of paths and Astarte datas. */
+  using MapType = std::vector<std::pair<std::string, AstarteData>>;
   /** @brief Helper type for size type of the map of paths and Astarte datas. */
   using size_type = MapType::size_type;
   /** @brief Helper type for value type of the map of paths and Astarte datas. */
-  using value_type = MapType::value_type;
+  using value_type = std::pair<const std::string, AstarteData>;
+
+  /**
+   * @brief Iterator over the elements of the object, sorted by path.
+   * @details Dereferencing yields a pair of references to the path and to the data of the element.
+   * The path is read only, as it determines the position of the element. The pair is returned by
+   * value, structured bindings over the elements should be declared as `const auto&` or `auto&&`.
+   * @tparam Const True for the iterator over a const object.
+   */
+  template <bool Const>
+  class Iterator {
+    using Base = std::conditional_t<Const, MapType::const_iterator, MapType::iterator>;
+    using Data = std::conditional_t<Const, const AstarteData, AstarteData>;
+
+   public:
+    /** @brief Category of the iterator, the references returned are proxies. */
+    using iterator_category = std::input_iterator_tag;
+    /** @brief Value type of the iterator. */
+    using value_type = AstarteDatastreamObject::value_type;
+    /** @brief Difference type of the iterator. */
+    using difference_type = std::ptrdiff_t;
+    /** @brief Reference type of the iterator, a pair of references to the path and data. */
+    using reference = std::pair<const std::string&, Data&>;
+
+    /** @brief Proxy returned by the member access operator, holding the dereferenced pair. */
+    class pointer {
+     public:
+      /**
+       * @brief Access the members of the dereferenced pair.
+       * @return Pointer to the dereferenced pair.
+       */
+      auto operator->() -> reference* { return &ref_; }
+
+     private:
+      friend class Iterator;
+      explicit pointer(reference ref) : ref_(ref) {}
+      reference ref_;
+    };
+
+    /** @brief Constructor for the class. To instantiate a singular iterator. */
+    Iterator() = default;
+    /**
+     * @brief Conversion from the iterator over a mutable object.
+     * @param other The iterator to convert.
+     */
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    Iterator(const Iterator<false>& other)
+      requires Const
+        : iter_(other.iter_) {}
+
+    /**
+     * @brief Dereference the iterator.
+     * @return A pair of references to the path and data of the element.
+     */
+    auto operator*() const -> reference { return {iter_->first, iter_->second}; }
+    /**
+     * @brief Access the path and data of the element.
+     * @return A proxy to the pair of references to the path and data of the element.
+     */
+    auto operator->() const -> pointer { return pointer(**this); }
+    /**
+     * @brief Advance the iterator to the next element.
+     * @return Reference to the iterator.
+     */
+    auto operator++() -> Iterator& {
+      ++iter_;
+      return *this;
+    }
+    /**
+     * @brief Advance the iterator to the next element.
+     * @return Copy of the iterator before the increment.
+     */
+    auto operator++(int) -> Iterator {
+      Iterator previous = *this;
+      ++iter_;
+      return previous;
+    }
+    /**
+     * @brief Move the iterator to the previous element.
+     * @return Reference to the iterator.
+     */
+    auto operator--() -> Iterator& {
+      --iter_;
+      return *this;
+    }
+    /**
+     * @brief Move the iterator to the previous element.
+     * @return Copy of the iterator before the decrement.
+     */
+    auto operator--(int) -> Iterator {
+      Iterator previous = *this;
+      --iter_;
+      return previous;
+    }
+    /**
+     * @brief Overloader for the comparison operator ==.
+     * @param other The iterator to compare to.
+     * @return True when both point at the same element, false otherwise.
+     */
+    [[nodiscard]] auto operator==(const Iterator& other) const -> bool {
+      return iter_ == other.iter_;
+    }
+
+   private:
+    friend class AstarteDatastreamObject;
+    friend class Iterator<true>;
+    explicit Iterator(Base iter) : iter_(iter) {}
+    Base iter_;
+  };
+
+  /** @brief Helper type for the iterator over the map of paths and Astarte datas. */
+  using iterator = Iterator<false>;
+  /** @brief Helper type for the const iterator over the map of paths and Astarte datas. */
+  using const_iterator = Iterator<true>;
 
   /** @brief Constructor for the class. To instantiate an empty object. */
   AstarteDatastreamObject();
@@ -41,90 +159,104 @@ class AstarteDatastreamObject {
   AstarteDatastreamObject(std::initializer_list<value_type> init);
   /**
    * @brief Access specified element with bounds checking.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @details The element is looked up with a binary search over the sorted paths.
    * @param key The key to search for.
    * @return Reference to the value corresponding to the key.
+   * @throw std::out_of_range When no element has the given key.
    */
-  auto at(const std::string& key) -> AstarteData&;
+  auto at(std::string_view key) -> AstarteData&;
   /**
    * @brief Access specified element with bounds checking.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @details The element is looked up with a binary search over the sorted paths.
    * @param key The key to search for.
    * @return Reference to the value corresponding to the key.
+   * @throw std::out_of_range When no element has the given key.
    */
-  auto at(const std::string& key) const -> const AstarteData&;
+  auto at(std::string_view key) const -> const AstarteData&;
   /**
-   * @brief Returns an iterator to the beginning of the specified bucket.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
-   * @return Iterator pointing at the beginning of the map.
+   * @brief Returns an iterator to the first element, elements are sorted by path.
+   * @return Iterator pointing at the first element.
    */
   auto begin() -> iterator;
   /**
-   * @brief Returns an iterator to the beginning of the specified bucket.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
-   * @return Iterator pointing at the beginning of the map.
+   * @brief Returns an iterator to the first element, elements are sorted by path.
+   * @return Iterator pointing at the first element.
    */
   auto begin() const -> const_iterator;
   /**
-   * @brief Returns an iterator to the end of the specified bucket.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
-   * @return Iterator pointing at the end of the map.
+   * @brief Returns an iterator past the last element.
+   * @return Iterator pointing past the last element.
    */
   auto end() -> iterator;
   /**
-   * @brief Returns an iterator to the end of the specified bucket.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
-   * @return Iterator pointing at the end of the map.
+   * @brief Returns an iterator past the last element.
+   * @return Iterator pointing past the last element.
    */
   auto end() const -> const_iterator;
   /**
    * @brief Returns the number of elements.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
-   * @return Number of elements in the map.
+   * @return Number of elements in the object.
    */
   auto size() const -> size_type;
   /**
-   * @brief Checks whether the container is empty.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
-   * @return True if the map is empty, false otherwise.
+   * @brief Checks whether the object is empty.
+   * @return True if the object is empty, false otherwise.
    */
   auto empty() const -> bool;
   /**
-   * @brief Insert elements.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @brief Reserve storage for the given number of elements.
+   * @param count Number of elements to reserve storage for.
+   */
+  void reserve(size_type count);
+  /**
+   * @brief Checks whether the container contains an element with the given key.
+   * @param key Key to search for.
+   * @return True if the element is present, false otherwise.
+   */
+  auto contains(std::string_view key) const -> bool;
+  /**
+   * @brief Insert an element at the position matching its path.
+   * @details Nothing is inserted when the key is already present. Inserting in path order appends
+   * to the storage, otherwise the following elements are shifted.
    * @param key Key to insert.
    * @param data Value to insert.
    */
   void insert(const std::string& key, const AstarteData& data);
   /**
-   * @brief Erases elements.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @brief Insert an element at the position matching its path, moving the key and the value.
+   * @details Nothing is inserted when the key is already present.
+   * @param key Key to insert.
+   * @param data Value to insert.
+   */
+  void insert(std::string&& key, AstarteData&& data);
+  /**
+   * @brief Erases the element with the given key.
+   * @details The following elements are shifted, invalidating the iterators pointing at them.
    * @param key Key to erase.
    * @return Number of elements removed (0 or 1).
    */
-  auto erase(const std::string& key) -> size_type;
+  auto erase(std::string_view key) -> size_type;
   /**
-   * @brief Clears the contents.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @brief Clears the contents, keeping the reserved storage.
    */
   void clear();
   /**
    * @brief Finds element with specific key.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @details The element is looked up with a binary search over the sorted paths.
    * @param key Key to find.
-   * @return An iterator to the requested element.
+   * @return An iterator to the requested element, or the end iterator when missing.
    */
-  auto find(const std::string& key) -> iterator;
+  auto find(std::string_view key) -> iterator;
   /**
    * @brief Finds element with specific key.
-   * @details Soft wrapper for the equivalent method in the std::unordered_map.
+   * @details The element is looked up with a binary search over the sorted paths.
    * @param key Key to find.
-   * @return An iterator to the requested element.
+   * @return An iterator to the requested element, or the end iterator when missing.
    */
-  auto find(const std::string& key) const -> const_iterator;
+  auto find(std::string_view key) const -> const_iterator;
   /**
    * @brief Return the raw data contained in this class instance.
-   * @return The raw data contained in this class instance.
+   * @return The elements of the object, sorted by path.
    */
   auto get_raw_data() const -> const MapType&;
   /**
@@ -141,6 +273,16 @@ class AstarteDatastreamObject {
   [[nodiscard]] auto operator!=(const AstarteDatastreamObject& other) const -> bool;
 
  private:
+  // First element with a path not less than the key
+  auto lower_bound(std::string_view key) -> MapType::iterator;
+  auto lower_bound(std::string_view key) const -> MapType::const_iterator;
+  // Element with a path equal to the key, or the end of the storage
+  auto find_element(std::string_view key) -> MapType::iterator;
+  auto find_element(std::string_view key) const -> MapType::const_iterator;
+  // Inserts the element at its sorted position, unless the key is already present
+  template <typename Key, typename Data>
+  void insert_sorted(Key&& key, Data&& data);
+
   MapType data_;
 };
 
@@ -0,0 +1,92 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_OUTGOING_MSG_H
+#define ASTARTE_DEVICE_SDK_OUTGOING_MSG_H
+
+/**
+ * @file astarte_device_sdk/outgoing_msg.hpp
+ * @brief Astarte outgoing message class and its related methods.
+ */
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/property.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Astarte outgoing message class, represents a full message to be sent to Astarte.
+ * @details Used to submit multiple messages in a single batch. A property with no value
+ * represents an unset operation. The timestamp is ignored for properties.
+ */
+class AstarteOutgoingMessage {
+ public:
+  /**
+   * @brief Constructor for the AstarteOutgoingMessage class.
+   * @param interface The interface for the message.
+   * @param path The path for the message.
+   * @param data The data for the message.
+   * @param timestamp The optional timestamp for the message.
+   */
+  template <typename T>
+  AstarteOutgoingMessage(std::string_view interface, std::string_view path, T data,
+                         std::optional<std::chrono::system_clock::time_point> timestamp =
+                             std::nullopt)
+      : interface_(interface), path_(path), data_(std::move(data)), timestamp_(timestamp) {}
+
+  /**
+   * @brief Get the interface of the message.
+   * @return The interface.
+   */
+  [[nodiscard]] auto get_interface() const -> const std::string&;
+  /**
+   * @brief Get the path of the message.
+   * @return The path.
+   */
+  [[nodiscard]] auto get_path() const -> const std::string&;
+  /**
+   * @brief Get the timestamp of the message.
+   * @return The timestamp, if any.
+   */
+  [[nodiscard]] auto get_timestamp() const
+      -> const std::optional<std::chrono::system_clock::time_point>&;
+  /**
+   * @brief Return the raw data contained in this class instance.
+   * @return The raw data contained in this class instance.
+   */
+  [[nodiscard]] auto get_raw_data() const
+      -> const std::variant<AstarteDatastreamIndividual, AstarteDatastreamObject,
+                            AstartePropertyIndividual>&;
+  /**
+   * @brief Overloader for the comparison operator ==.
+   * @param other The object to compare to.
+   * @return True when equal, false otherwise.
+   */
+  [[nodiscard]] auto operator==(const AstarteOutgoingMessage& other) const -> bool;
+  /**
+   * @brief Overloader for the comparison operator !=.
+   * @param other The object to compare to.
+   * @return True when different, false otherwise.
+   */
+  [[nodiscard]] auto operator!=(const AstarteOutgoingMessage& other) const -> bool;
+
+ private:
+  std::string interface_;
+  std::string path_;
+  std::variant<AstarteDatastreamIndividual, AstarteDatastreamObject, AstartePropertyIndividual>
+      data_;
+  std::optional<std::chrono::system_clock::time_point> timestamp_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_OUTGOING_MSG_H
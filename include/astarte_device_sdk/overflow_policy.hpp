@@ -0,0 +1,46 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_OVERFLOW_POLICY_H
+#define ASTARTE_DEVICE_SDK_OVERFLOW_POLICY_H
+
+/**
+ * @file astarte_device_sdk/overflow_policy.hpp
+ * @brief Policies applied when a bounded message queue is full.
+ */
+
+#include <cstdint>
+#include <string_view>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Possible behaviours when inserting in a full bounded queue. */
+enum AstarteOverflowPolicy : int8_t {
+  /** @brief Block the caller until space is available in the queue. */
+  kBlock,
+  /** @brief Discard the oldest message in the queue to make room for the new one. */
+  kDropOldest,
+  /** @brief Discard the new message, leaving the queue unchanged. */
+  kDropNewest,
+  /** @brief Refuse the new message, returning an error to the caller. */
+  kFail
+};
+
+static constexpr auto overflow_policy_as_str(AstarteOverflowPolicy policy) -> std::string_view {
+  switch (policy) {
+    case AstarteOverflowPolicy::kBlock:
+      return "block";
+    case AstarteOverflowPolicy::kDropOldest:
+      return "drop oldest";
+    case AstarteOverflowPolicy::kDropNewest:
+      return "drop newest";
+    case AstarteOverflowPolicy::kFail:
+      return "fail";
+  }
+  return "unknown";
+}
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_OVERFLOW_POLICY_H
@@ -24,6 +24,11 @@ class AstartePropertyIndividual {
    * @param data The wrapped Astarte data type.
    */
   explicit AstartePropertyIndividual(const std::optional<AstarteData>& data);
+  /**
+   * @brief Constructor for the AstarteDatastreamIndividual class, moving the data.
+   * @param data The wrapped Astarte data type.
+   */
+  explicit AstartePropertyIndividual(std::optional<AstarteData>&& data);
   /**
    * @brief Get the value contained within the object.
    * @return A constant reference to the data, if any.
@@ -0,0 +1,56 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_RECEPTION_QUEUE_H
+#define ASTARTE_DEVICE_SDK_RECEPTION_QUEUE_H
+
+/**
+ * @file astarte_device_sdk/reception_queue.hpp
+ * @brief Implementations of the queue holding the messages received from Astarte.
+ */
+
+#include <cstdint>
+#include <string_view>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Possible implementations of the reception queue. */
+enum AstarteReceptionQueue : int8_t {
+  /**
+   * @brief Lock-free queue, received messages should be consumed by a single thread at a time.
+   */
+  kSingleConsumer,
+  /** @brief Queue protected by a mutex, received messages can be consumed by multiple threads. */
+  kMultiConsumer,
+  /**
+   * @brief Multi consumer queue holding only the latest value of each property.
+   * @details A received property replaces in place a pending message for the same interface and
+   * path. Datastreams are kept in FIFO order.
+   */
+  kConflating,
+  /**
+   * @brief Queue delivering each received message to all the message consumers of the device.
+   * @details Messages are decoded once and shared, immutable, between the consumers, each one
+   * having its own buffer. Messages received while there are no consumers are dropped.
+   */
+  kMulticast
+};
+
+static constexpr auto reception_queue_as_str(AstarteReceptionQueue queue) -> std::string_view {
+  switch (queue) {
+    case AstarteReceptionQueue::kSingleConsumer:
+      return "single consumer";
+    case AstarteReceptionQueue::kMultiConsumer:
+      return "multi consumer";
+    case AstarteReceptionQueue::kConflating:
+      return "conflating";
+    case AstarteReceptionQueue::kMulticast:
+      return "multicast";
+  }
+  return "unknown";
+}
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_RECEPTION_QUEUE_H
@@ -0,0 +1,135 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_SERIES_H
+#define ASTARTE_DEVICE_SDK_SERIES_H
+
+/**
+ * @file astarte_device_sdk/series.hpp
+ * @brief Astarte datastream series class, holding many samples of a single endpoint.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+/** @brief Restricts the allowed sample types for instances of an Astarte datastream series. */
+template <typename T>
+concept AstarteSeriesAllowedType = requires {
+  requires std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> || std::is_same_v<T, double> ||
+               std::is_same_v<T, bool> || std::is_same_v<T, std::string> ||
+               std::is_same_v<T, std::vector<uint8_t>> ||
+               std::is_same_v<T, std::chrono::system_clock::time_point>;
+};
+
+/**
+ * @brief Astarte datastream series class, representing samples of a single individual endpoint.
+ * @details The samples are stored as a structure of arrays: one vector of timestamps and one
+ * vector of values, all of the same type. Compared to a sequence of AstarteData, no per sample
+ * allocation is required for scalar values, and the interface, path and type of the samples are
+ * validated once for the whole series when it is sent.
+ */
+class AstarteDatastreamSeries {
+ public:
+  /** @brief Helper type for the variant of vectors holding the values of the series. */
+  using VariantType =
+      std::variant<std::vector<int32_t>, std::vector<int64_t>, std::vector<double>,
+                   std::vector<bool>, std::vector<std::string>, std::vector<std::vector<uint8_t>>,
+                   std::vector<std::chrono::system_clock::time_point>>;
+
+  /**
+   * @brief Constructor for the AstarteDatastreamSeries class.
+   * @details The two vectors should have the same size, a series with mismatching sizes is
+   * refused when sent.
+   * @param values The values of the samples.
+   * @param timestamps The timestamps of the samples, in the same order as the values.
+   */
+  template <AstarteSeriesAllowedType T>
+  AstarteDatastreamSeries(std::vector<T> values,
+                          std::vector<std::chrono::system_clock::time_point> timestamps)
+      : values_(std::move(values)), timestamps_(std::move(timestamps)) {}
+
+  /**
+   * @brief Append a sample to the series.
+   * @details T should be the type of the values of the series, std::bad_variant_access is thrown
+   * otherwise.
+   * @param value The value of the sample.
+   * @param timestamp The timestamp of the sample.
+   */
+  template <AstarteSeriesAllowedType T>
+  void push_back(T value, std::chrono::system_clock::time_point timestamp) {
+    std::get<std::vector<T>>(values_).push_back(std::move(value));
+    timestamps_.push_back(timestamp);
+  }
+  /**
+   * @brief Reserve storage for a number of samples, avoiding reallocations while appending.
+   * @param capacity The total number of samples to reserve storage for.
+   */
+  void reserve(std::size_t capacity);
+  /** @brief Remove all the samples, keeping the allocated storage and the type of the series. */
+  void clear();
+
+  /**
+   * @brief Get the number of samples in the series.
+   * @return The number of values in the series.
+   */
+  [[nodiscard]] auto size() const -> std::size_t;
+  /**
+   * @brief Check if the series has no samples.
+   * @return True if the series is empty, false otherwise.
+   */
+  [[nodiscard]] auto empty() const -> bool;
+  /**
+   * @brief Get the Astarte type of the samples.
+   * @return The type of each value of the series.
+   */
+  [[nodiscard]] auto get_type() const -> AstarteType;
+  /**
+   * @brief Get the timestamps of the samples.
+   * @return A constant reference to the timestamps.
+   */
+  [[nodiscard]] auto get_timestamps() const
+      -> const std::vector<std::chrono::system_clock::time_point>&;
+  /**
+   * @brief Return the raw values contained in this class instance.
+   * @return The values of the series. This is a variant containing one of the possible vectors.
+   */
+  [[nodiscard]] auto get_raw_data() const -> const VariantType&;
+  /**
+   * @brief Copy a single value of the series into a new Astarte data instance.
+   * @param index The index of the sample, should be lower than size().
+   * @return The new Astarte data instance.
+   */
+  [[nodiscard]] auto value_at(std::size_t index) const -> AstarteData;
+  /**
+   * @brief Overloader for the comparison operator ==.
+   * @param other The object to compare to.
+   * @return True when equal, false otherwise.
+   */
+  [[nodiscard]] auto operator==(const AstarteDatastreamSeries& other) const -> bool;
+  /**
+   * @brief Overloader for the comparison operator !=.
+   * @param other The object to compare to.
+   * @return True when different, false otherwise.
+   */
+  [[nodiscard]] auto operator!=(const AstarteDatastreamSeries& other) const -> bool;
+
+ private:
+  VariantType values_;
+  std::vector<std::chrono::system_clock::time_point> timestamps_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_SERIES_H
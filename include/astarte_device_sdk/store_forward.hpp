@@ -0,0 +1,44 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_STORE_FORWARD_H
+#define ASTARTE_DEVICE_SDK_STORE_FORWARD_H
+
+/**
+ * @file astarte_device_sdk/store_forward.hpp
+ * @brief Configuration for the buffering of datastreams while the device is disconnected.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Configuration of the store and forward buffer.
+ * @details Datastreams sent while the device is disconnected are buffered according to the
+ * retention of their mapping. Volatile data is kept in memory while stored data is written to
+ * disk. Buffered data is transmitted in order once the device reconnects.
+ */
+struct AstarteStoreForwardConfig {
+  /** @brief Maximum number of volatile messages kept in memory. Oldest messages are discarded. */
+  std::size_t volatile_capacity{1024};
+  /**
+   * @brief Directory where stored messages are persisted.
+   * @details When empty, stored messages are kept in memory as volatile ones.
+   */
+  std::filesystem::path storage_dir;
+  /** @brief Maximum size in bytes of the persisted messages. Oldest messages are discarded. */
+  std::uintmax_t storage_max_size{64 * 1024 * 1024};
+  /**
+   * @brief Maximum number of buffered messages transmitted each second after a reconnection.
+   * @details Only the buffered data is limited, data sent while connected is not delayed.
+   */
+  std::uint32_t replay_rate{100};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_STORE_FORWARD_H
@@ -15,6 +15,7 @@
 #include <string_view>
 
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/interned_string.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 
 namespace AstarteDeviceSdk {
@@ -43,6 +44,12 @@ class AstarteStoredProperty {
    * @return A constant reference to the path string.
    */
   [[nodiscard]] auto get_path() const -> const std::string&;
+  /**
+   * @brief Get the handle to the interface name contained within the object.
+   * @details Handles to the interfaces registered in the SDK are compared in constant time.
+   * @return A constant reference to the interface name handle.
+   */
+  [[nodiscard]] auto get_interface_handle() const -> const AstarteInternedString&;
   /**
    * @brief Get the major version within the object.
    * @details The major version is the major version of the interface of the property.
@@ -74,8 +81,8 @@ class AstarteStoredProperty {
   [[nodiscard]] auto operator!=(const AstarteStoredProperty& other) const -> bool;
 
  private:
-  std::string interface_name_;
-  std::string path_;
+  AstarteInternedString interface_name_;
+  AstarteInternedString path_;
   int32_t version_major_;
   AstarteOwnership ownership_;
   AstarteData data_;
@@ -0,0 +1,344 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_TYPED_ENDPOINT_H
+#define ASTARTE_DEVICE_SDK_TYPED_ENDPOINT_H
+
+/**
+ * @file astarte_device_sdk/typed_endpoint.hpp
+ * @brief Strongly typed endpoints, used by the interfaces generated with
+ * astarte_generate_interfaces.
+ */
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
+#include "astarte_device_sdk/device.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief C++ type used to store the values of an Astarte type.
+ * @tparam Type The Astarte type of a mapping.
+ */
+template <AstarteType Type>
+struct AstarteTypeTraits;
+
+/** @cond Doxygen should skip the specializations */
+template <>
+struct AstarteTypeTraits<AstarteType::kBinaryBlob> {
+  using value_type = std::vector<uint8_t>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kBoolean> {
+  using value_type = bool;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kDatetime> {
+  using value_type = std::chrono::system_clock::time_point;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kDouble> {
+  using value_type = double;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kInteger> {
+  using value_type = int32_t;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kLongInteger> {
+  using value_type = int64_t;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kString> {
+  using value_type = std::string;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kBinaryBlobArray> {
+  using value_type = std::vector<std::vector<uint8_t>>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kBooleanArray> {
+  using value_type = std::vector<bool>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kDatetimeArray> {
+  using value_type = std::vector<std::chrono::system_clock::time_point>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kDoubleArray> {
+  using value_type = std::vector<double>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kIntegerArray> {
+  using value_type = std::vector<int32_t>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kLongIntegerArray> {
+  using value_type = std::vector<int64_t>;
+};
+template <>
+struct AstarteTypeTraits<AstarteType::kStringArray> {
+  using value_type = std::vector<std::string>;
+};
+/** @endcond */
+
+/**
+ * @brief Restricts the values accepted by a typed endpoint to the ones implicitly convertible to
+ * its type, excluding narrowing conversions between arithmetic types.
+ * @details As for the messages validated by the device, integer arrays are widened for long
+ * integer array mappings, like integers are for long integer mappings.
+ */
+template <typename T, AstarteType Type>
+concept AstarteTypedValue =
+    (std::convertible_to<T, typename AstarteTypeTraits<Type>::value_type> &&
+     (!std::is_arithmetic_v<typename AstarteTypeTraits<Type>::value_type> ||
+      requires(T&& value) {
+        { typename AstarteTypeTraits<Type>::value_type{std::forward<T>(value)} };
+      })) ||
+    ((Type == AstarteType::kLongIntegerArray) &&
+     std::is_same_v<std::remove_cvref_t<T>, std::vector<int32_t>>);
+
+namespace detail {
+
+// Converts a value to the type of the mapping, widening the integer arrays element by element
+template <AstarteType Type, typename T>
+auto to_typed_value(T&& value) -> typename AstarteTypeTraits<Type>::value_type {
+  using ValueType = typename AstarteTypeTraits<Type>::value_type;
+  if constexpr ((Type == AstarteType::kLongIntegerArray) &&
+                std::is_same_v<std::remove_cvref_t<T>, std::vector<int32_t>>) {
+    return ValueType(value.begin(), value.end());
+  } else {
+    return static_cast<ValueType>(std::forward<T>(value));
+  }
+}
+
+// Builds the payload for a value of the given type. Scalars are stored inline in the data, while
+// vectors are serialized directly from their buffer through a view.
+template <AstarteType Type, typename T>
+auto send_typed(AstarteDevice& device, std::string_view interface_name, std::string_view path,
+                T&& value, const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  using ValueType = typename AstarteTypeTraits<Type>::value_type;
+  if constexpr (std::is_same_v<std::remove_cvref_t<T>, ValueType> &&
+                requires { AstarteDataView(value); }) {
+    return device.send_individual(interface_name, path, AstarteDataView(value), timestamp);
+  } else {
+    return device.send_individual(interface_name, path,
+                                  AstarteData(to_typed_value<Type>(std::forward<T>(value))),
+                                  timestamp);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Individual datastream endpoint, owned by the device.
+ * @details Values are checked against the type of the mapping at compile time.
+ * @tparam Type The Astarte type of the mapping.
+ */
+template <AstarteType Type>
+class AstarteDatastreamEndpoint {
+ public:
+  /** @brief Helper type for the values of the endpoint. */
+  using value_type = typename AstarteTypeTraits<Type>::value_type;
+
+  /**
+   * @brief Constructor for the AstarteDatastreamEndpoint class.
+   * @param interface_name The name of the interface, should outlive the endpoint.
+   * @param path The endpoint of the mapping, should outlive the endpoint.
+   */
+  constexpr AstarteDatastreamEndpoint(std::string_view interface_name, std::string_view path)
+      : interface_name_(interface_name), path_(path) {}
+
+  /** @return The name of the interface. */
+  [[nodiscard]] constexpr auto interface_name() const -> std::string_view {
+    return interface_name_;
+  }
+  /** @return The endpoint of the mapping, might contain parameters in the form %{name}. */
+  [[nodiscard]] constexpr auto path() const -> std::string_view { return path_; }
+
+  /**
+   * @brief Send a value to the endpoint of a non parametric mapping.
+   * @param device The device to use for the transmission.
+   * @param value The value to send.
+   * @param timestamp The timestamp for the value, this might be a nullptr.
+   * @return An error if generated.
+   */
+  template <AstarteTypedValue<Type> T>
+  auto send(AstarteDevice& device, T&& value,
+            const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError> {
+    return detail::send_typed<Type>(device, interface_name_, path_, std::forward<T>(value),
+                                    timestamp);
+  }
+  /**
+   * @brief Send a value to a path matching the endpoint of a parametric mapping.
+   * @param device The device to use for the transmission.
+   * @param path The path, with the parameters replaced by their values.
+   * @param value The value to send.
+   * @param timestamp The timestamp for the value, this might be a nullptr.
+   * @return An error if generated.
+   */
+  template <AstarteTypedValue<Type> T>
+  auto send(AstarteDevice& device, std::string_view path, T&& value,
+            const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError> {
+    return detail::send_typed<Type>(device, interface_name_, path, std::forward<T>(value),
+                                    timestamp);
+  }
+
+ private:
+  std::string_view interface_name_;
+  std::string_view path_;
+};
+
+/**
+ * @brief Individual property endpoint, owned by the device.
+ * @details Values are checked against the type of the mapping at compile time.
+ * @tparam Type The Astarte type of the mapping.
+ */
+template <AstarteType Type>
+class AstartePropertyEndpoint {
+ public:
+  /** @brief Helper type for the values of the endpoint. */
+  using value_type = typename AstarteTypeTraits<Type>::value_type;
+
+  /**
+   * @brief Constructor for the AstartePropertyEndpoint class.
+   * @param interface_name The name of the interface, should outlive the endpoint.
+   * @param path The endpoint of the mapping, should outlive the endpoint.
+   */
+  constexpr AstartePropertyEndpoint(std::string_view interface_name, std::string_view path)
+      : interface_name_(interface_name), path_(path) {}
+
+  /** @return The name of the interface. */
+  [[nodiscard]] constexpr auto interface_name() const -> std::string_view {
+    return interface_name_;
+  }
+  /** @return The endpoint of the mapping, might contain parameters in the form %{name}. */
+  [[nodiscard]] constexpr auto path() const -> std::string_view { return path_; }
+
+  /**
+   * @brief Set the property of a non parametric mapping.
+   * @param device The device to use for the transmission.
+   * @param value The property value.
+   * @return An error if generated.
+   */
+  template <AstarteTypedValue<Type> T>
+  auto set(AstarteDevice& device, T&& value) const -> astarte_tl::expected<void, AstarteError> {
+    return set(device, path_, std::forward<T>(value));
+  }
+  /**
+   * @brief Set the property of a path matching the endpoint of a parametric mapping.
+   * @param device The device to use for the transmission.
+   * @param path The path, with the parameters replaced by their values.
+   * @param value The property value.
+   * @return An error if generated.
+   */
+  template <AstarteTypedValue<Type> T>
+  auto set(AstarteDevice& device, std::string_view path, T&& value) const
+      -> astarte_tl::expected<void, AstarteError> {
+    return device.set_property(interface_name_, path,
+                               AstarteData(detail::to_typed_value<Type>(std::forward<T>(value))));
+  }
+  /**
+   * @brief Unset the property of a non parametric mapping.
+   * @param device The device to use for the transmission.
+   * @return An error if generated.
+   */
+  auto unset(AstarteDevice& device) const -> astarte_tl::expected<void, AstarteError> {
+    return device.unset_property(interface_name_, path_);
+  }
+  /**
+   * @brief Unset the property of a path matching the endpoint of a parametric mapping.
+   * @param device The device to use for the transmission.
+   * @param path The path, with the parameters replaced by their values.
+   * @return An error if generated.
+   */
+  auto unset(AstarteDevice& device, std::string_view path) const
+      -> astarte_tl::expected<void, AstarteError> {
+    return device.unset_property(interface_name_, path);
+  }
+
+ private:
+  std::string_view interface_name_;
+  std::string_view path_;
+};
+
+/**
+ * @brief Object aggregated datastream endpoint, owned by the device.
+ * @details The generated object types store each mapping in a typed member and are converted to
+ * an AstarteDatastreamObject, with storage reserved for all the mappings, when sent.
+ * @tparam Object The generated type of the object.
+ */
+template <typename Object>
+class AstarteObjectEndpoint {
+ public:
+  /**
+   * @brief Constructor for the AstarteObjectEndpoint class.
+   * @param interface_name The name of the interface, should outlive the endpoint.
+   * @param path The common path of the object mappings, should outlive the endpoint.
+   */
+  constexpr AstarteObjectEndpoint(std::string_view interface_name, std::string_view path)
+      : interface_name_(interface_name), path_(path) {}
+
+  /** @return The name of the interface. */
+  [[nodiscard]] constexpr auto interface_name() const -> std::string_view {
+    return interface_name_;
+  }
+  /** @return The common path of the mappings, might contain parameters in the form %{name}. */
+  [[nodiscard]] constexpr auto path() const -> std::string_view { return path_; }
+
+  /**
+   * @brief Send an object to the common path of non parametric mappings.
+   * @param device The device to use for the transmission.
+   * @param object The object to send.
+   * @param timestamp The timestamp for the object, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send(AstarteDevice& device, const Object& object,
+            const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError> {
+    return send(device, path_, object, timestamp);
+  }
+  /**
+   * @brief Send an object to a path matching the common path of parametric mappings.
+   * @param device The device to use for the transmission.
+   * @param path The path, with the parameters replaced by their values.
+   * @param object The object to send.
+   * @param timestamp The timestamp for the object, this might be a nullptr.
+   * @return An error if generated.
+   */
+  auto send(AstarteDevice& device, std::string_view path, const Object& object,
+            const std::chrono::system_clock::time_point* timestamp) const
+      -> astarte_tl::expected<void, AstarteError> {
+    return device.send_object(interface_name_, path, object.to_object(), timestamp);
+  }
+
+ private:
+  std::string_view interface_name_;
+  std::string_view path_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_TYPED_ENDPOINT_H
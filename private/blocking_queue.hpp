@@ -0,0 +1,90 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Interface of the queues handing items from a producer thread to consumer threads.
+ * @details Consumers can block waiting for new items. Items are moved in and out of the queue.
+ * Queues can be bounded, in which case an overflow policy is applied when pushing to a full queue.
+ */
+template <typename T>
+class BlockingQueue {
+ public:
+  /** @brief Virtual destructor. */
+  virtual ~BlockingQueue() = default;
+  /** @brief Copy constructor for the blocking queue. */
+  BlockingQueue(const BlockingQueue&) = delete;
+  /** @brief Move constructor for the blocking queue. */
+  BlockingQueue(BlockingQueue&&) = delete;
+  /** @brief Copy assignment operator for the blocking queue. */
+  auto operator=(const BlockingQueue&) -> BlockingQueue& = delete;
+  /** @brief Move assignment operator for the blocking queue. */
+  auto operator=(BlockingQueue&&) -> BlockingQueue& = delete;
+
+  /**
+   * @brief Push a new item in the queue, waking up a waiting consumer.
+   * @details When the queue is full the overflow policy is applied. With the kBlock policy the
+   * producer waits for space in the queue or for a stop request.
+   * @param item The item to push.
+   * @param token Stop token interrupting a blocked push.
+   * @return False if the item has not been stored in the queue, true otherwise.
+   */
+  virtual auto push(T item, const std::stop_token& token) -> bool = 0;
+  /**
+   * @brief Push a new item in the queue, without the possibility of being interrupted.
+   * @param item The item to push.
+   * @return False if the item has not been stored in the queue, true otherwise.
+   */
+  auto push(T item) -> bool { return push(std::move(item), std::stop_token()); }
+  /**
+   * @brief Pop the oldest item from the queue.
+   * @param timeout Will block for this timeout if the queue is empty.
+   * @return The item if one was available, std::nullopt otherwise.
+   */
+  virtual auto pop(const std::chrono::milliseconds& timeout) -> std::optional<T> = 0;
+  /**
+   * @brief Move up to max items from the queue into out, waiting only for the first one.
+   * @param out The vector where the items are appended.
+   * @param max The maximum number of items to move.
+   * @param timeout Will block for this timeout if the queue is empty.
+   * @return The number of items appended to out.
+   */
+  virtual auto pop_batch(std::vector<T>& out, std::size_t max,
+                         const std::chrono::milliseconds& timeout) -> std::size_t = 0;
+  /**
+   * @brief Get the number of items in the queue.
+   * @return The number of items in the queue.
+   */
+  virtual auto size() -> std::size_t = 0;
+  /**
+   * @brief Check if the queue is empty.
+   * @return True if the queue is empty, false otherwise.
+   */
+  virtual auto empty() -> bool = 0;
+  /**
+   * @brief Get the number of items discarded by the overflow policy.
+   * @return The number of dropped items.
+   */
+  virtual auto dropped() -> std::uint64_t = 0;
+
+ protected:
+  /** @brief Protected default constructor. */
+  BlockingQueue() = default;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // BLOCKING_QUEUE_H
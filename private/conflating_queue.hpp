@@ -0,0 +1,189 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CONFLATING_QUEUE_H
+#define CONFLATING_QUEUE_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "blocking_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Conflation key of the received messages.
+ * @details Properties are keyed by interface and path, datastreams are never conflated.
+ */
+struct PropertyConflationKey {
+  auto operator()(const AstarteMessage& message) const -> std::optional<std::string> {
+    if (message.is_datastream()) {
+      return std::nullopt;
+    }
+    std::string key;
+    key.reserve(message.get_interface().size() + message.get_path().size() + 1);
+    key.append(message.get_interface()).push_back('\0');
+    key.append(message.get_path());
+    return key;
+  }
+};
+
+/**
+ * @brief Queue protected by a mutex, replacing pending items that share the same key.
+ * @details A pushed item with a key replaces in place the pending item with the same key, if any,
+ * keeping its position in the queue. Items without a key are always appended in FIFO order.
+ * The queue holds at most one item per key.
+ */
+template <typename T, typename KeyOf>
+class ConflatingQueue : public BlockingQueue<T> {
+ public:
+  using BlockingQueue<T>::push;
+
+  /**
+   * @brief Construct a new conflating queue.
+   * @param capacity The maximum number of items in the queue, zero for an unbounded queue.
+   * @param policy The policy to apply when pushing to a full queue, with the same meaning as for
+   * SharedQueue.
+   */
+  explicit ConflatingQueue(std::size_t capacity = 0,
+                           AstarteOverflowPolicy policy = AstarteOverflowPolicy::kBlock)
+      : capacity_(capacity), policy_(policy) {}
+
+  auto pop(const std::chrono::milliseconds& timeout) -> std::optional<T> override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    if (condition_.wait_for(mlock, timeout, [this] { return !queue_.empty(); })) {
+      T res = pop_front();
+      not_full_.notify_one();
+      return res;
+    }
+    return std::nullopt;
+  }
+  auto pop_batch(std::vector<T>& out, std::size_t max, const std::chrono::milliseconds& timeout)
+      -> std::size_t override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    if ((max == 0) || !condition_.wait_for(mlock, timeout, [this] { return !queue_.empty(); })) {
+      return 0;
+    }
+    const std::size_t count = std::min(max, queue_.size());
+    out.reserve(out.size() + count);
+    for (std::size_t i = 0; i < count; ++i) {
+      out.push_back(pop_front());
+    }
+    // More than one slot might have been freed
+    not_full_.notify_all();
+    return count;
+  }
+  auto push(T item, const std::stop_token& token) -> bool override {
+    std::optional<std::string> key = key_of_(item);
+    std::unique_lock<std::mutex> mlock(mutex_);
+    if (key) {
+      auto pending = pending_.find(key.value());
+      if (pending != pending_.end()) {
+        queue_[pending->second - head_seq_].item = std::move(item);
+        conflated_++;
+        return true;
+      }
+    }
+    if (full()) {
+      switch (policy_) {
+        case AstarteOverflowPolicy::kBlock:
+          if (!not_full_.wait(mlock, token, [this] { return !full(); })) {
+            dropped_++;
+            return false;
+          }
+          break;
+        case AstarteOverflowPolicy::kDropOldest:
+          (void)pop_front();
+          dropped_++;
+          break;
+        case AstarteOverflowPolicy::kDropNewest:
+          dropped_++;
+          return false;
+        case AstarteOverflowPolicy::kFail:
+          return false;
+      }
+    }
+    if (key) {
+      // A concurrent producer might have pushed the same key while waiting for space
+      auto pending = pending_.find(key.value());
+      if (pending != pending_.end()) {
+        queue_[pending->second - head_seq_].item = std::move(item);
+        conflated_++;
+        return true;
+      }
+      pending_.emplace(key.value(), head_seq_ + queue_.size());
+    }
+    queue_.push_back(Entry{.key = std::move(key), .item = std::move(item)});
+    condition_.notify_one();
+    return true;
+  }
+  auto size() -> std::size_t override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    return queue_.size();
+  }
+  auto empty() -> bool override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    return queue_.empty();
+  }
+  auto dropped() -> std::uint64_t override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    return dropped_;
+  }
+  /**
+   * @brief Get the number of pending items that have been replaced by a newer item.
+   * @return The number of replaced items.
+   */
+  auto conflated() -> std::uint64_t {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    return conflated_;
+  }
+
+ private:
+  struct Entry {
+    std::optional<std::string> key;
+    T item;
+  };
+
+  auto full() -> bool { return (capacity_ != 0) && (queue_.size() >= capacity_); }
+  auto pop_front() -> T {
+    Entry entry = std::move(queue_.front());
+    queue_.pop_front();
+    head_seq_++;
+    if (entry.key) {
+      pending_.erase(entry.key.value());
+    }
+    return std::move(entry.item);
+  }
+
+  std::size_t capacity_;
+  AstarteOverflowPolicy policy_;
+  KeyOf key_of_;
+  std::uint64_t dropped_{0};
+  std::uint64_t conflated_{0};
+  std::deque<Entry> queue_;
+  // Sequence number of the front of the queue, the position of an item is its sequence number
+  // minus the sequence number of the front
+  std::uint64_t head_seq_{0};
+  std::unordered_map<std::string, std::uint64_t> pending_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::condition_variable_any not_full_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // CONFLATING_QUEUE_H
@@ -12,33 +12,67 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "astarte_device_sdk/awaitable.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/device_grpc.hpp"
 #include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/message_handler.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/reception_queue.hpp"
+#include "astarte_device_sdk/series.hpp"
+#include "astarte_device_sdk/store_forward.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
+#include "blocking_queue.hpp"
+#include "event_notifier.hpp"
+#include "grpc_arena.hpp"
+#include "grpc_async.hpp"
+#include "interface.hpp"
+#include "message_dispatcher.hpp"
+#include "multicast_queue.hpp"
+#include "ordered_worker_pool.hpp"
 #include "shared_queue.hpp"
+#include "store_forward_buffer.hpp"
+#include "subscription_router.hpp"
 
 namespace AstarteDeviceSdk {
 
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
 using gRPCMessageHub = astarteplatform::msghub::MessageHub;
 using gRPCMessageHubEvent = astarteplatform::msghub::MessageHubEvent;
 
 struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
  public:
+  /** @brief Awaitable result of an asynchronous transmission. */
+  using SendAwaitable = AstarteAwaitable<astarte_tl::expected<void, AstarteError>>;
+  /** @brief Awaitable received message. */
+  using MessageAwaitable = AstarteAwaitable<astarte_tl::expected<AstarteMessage, AstarteError>>;
+
   /**
    * @brief Construct an AstarteDeviceGrpcImpl instance.
    * @param server_addr The gRPC server address for the Astarte message hub.
@@ -90,6 +124,39 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
    * @details Gracefully terminates the connection by sending a Detach message.
    */
   auto disconnect() -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Enable the outbound queue for the blocking send functions.
+   * @details Messages are queued and transmitted by a dedicated sender thread. Should be called
+   * while the device is disconnected.
+   * @param capacity The maximum number of messages stored in the queue.
+   * @param policy The policy to apply when the queue is full.
+   */
+  auto set_outbound_queue(std::size_t capacity, AstarteOverflowPolicy policy)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Get the number of queued messages lost because their transmission failed.
+   * @return The number of failed messages of the outbound queue.
+   */
+  auto get_failed_messages() -> std::uint64_t;
+  /**
+   * @brief Get the generation of the interfaces of the device.
+   * @details The generation changes every time an interface is added or removed.
+   * @return The current generation.
+   */
+  [[nodiscard]] auto get_interfaces_generation() const -> std::uint64_t;
+  /**
+   * @brief Get a copy of an interface added to the device.
+   * @param interface_name The name of the interface.
+   * @return The interface or std::nullopt if it has not been added.
+   */
+  auto find_interface(std::string_view interface_name) -> std::optional<AstarteInterface>;
+  /**
+   * @brief Enable buffering of the datastreams sent while disconnected.
+   * @details Should be called while the device is disconnected.
+   * @param config The store and forward configuration.
+   */
+  auto set_store_and_forward(const AstarteStoreForwardConfig& config)
+      -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Send an individual datastream value to an interface.
    * @param interface_name The name of the interface to send data to.
@@ -101,6 +168,27 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
                        const AstarteData& data,
                        const std::chrono::system_clock::time_point* timestamp)
       -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send an individual datastream value to an interface, moving the payload.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path within the interface (e.g., "/endpoint/value").
+   * @param data The data point to send.
+   * @param timestamp An optional timestamp for the data point.
+   */
+  auto send_individual(std::string_view interface_name, std::string_view path, AstarteData&& data,
+                       const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send an individual datastream value to an interface, from a non-owned buffer.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path within the interface (e.g., "/endpoint/value").
+   * @param data The view over the data point to send.
+   * @param timestamp An optional timestamp for the data point.
+   */
+  auto send_individual(std::string_view interface_name, std::string_view path,
+                       const AstarteDataView& data,
+                       const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Send a datastream object to an interface.
    * @param interface_name The name of the interface to send data to.
@@ -112,6 +200,17 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
                    const AstarteDatastreamObject& object,
                    const std::chrono::system_clock::time_point* timestamp)
       -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send a datastream object to an interface, moving the payload.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The base path for the object within the interface.
+   * @param object The key-value map representing the object to send.
+   * @param timestamp An optional timestamp for the data.
+   */
+  auto send_object(std::string_view interface_name, std::string_view path,
+                   AstarteDatastreamObject&& object,
+                   const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Set a device property on an interface.
    * @param interface_name The name of the interface where the property is defined.
@@ -120,6 +219,14 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
    */
   auto set_property(std::string_view interface_name, std::string_view path, const AstarteData& data)
       -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Set a device property on an interface, moving the payload.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to set.
+   * @param data The value to set for the property.
+   */
+  auto set_property(std::string_view interface_name, std::string_view path, AstarteData&& data)
+      -> astarte_tl::expected<void, AstarteError>;
   /**
    * @brief Unset a device property on an interface.
    * @details This sends a message to the server to clear the value of a specific property.
@@ -128,6 +235,122 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
    */
   auto unset_property(std::string_view interface_name, std::string_view path)
       -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Send multiple messages, pipelining them toward the message hub.
+   * @details Refused when called from the completion queue thread, which would have to complete
+   * the calls the function is waiting for.
+   * @param messages The messages to send.
+   * @return A result for each message, in the same order as the input messages.
+   */
+  auto send_batch(std::span<const AstarteOutgoingMessage> messages)
+      -> std::vector<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send the samples of a series, pipelining them toward the message hub.
+   * @param interface_name The name of the interface on which to send the samples.
+   * @param path The path on the interface on which to send the samples.
+   * @details Refused when called from the completion queue thread, as send_batch.
+   * @param series The samples to send.
+   * @return A result for each sample, in the same order as the samples of the series.
+   */
+  auto send_series(std::string_view interface_name, std::string_view path,
+                   const AstarteDatastreamSeries& series)
+      -> std::vector<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send an individual datastream value to an interface without blocking.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path within the interface (e.g., "/endpoint/value").
+   * @param data The data point to send.
+   * @param timestamp An optional timestamp for the data point.
+   * @return A future that will hold the result of the operation.
+   */
+  auto send_individual_async(std::string_view interface_name, std::string_view path,
+                             const AstarteData& data,
+                             const std::chrono::system_clock::time_point* timestamp)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send a datastream object to an interface without blocking.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The base path for the object within the interface.
+   * @param object The key-value map representing the object to send.
+   * @param timestamp An optional timestamp for the data.
+   * @return A future that will hold the result of the operation.
+   */
+  auto send_object_async(std::string_view interface_name, std::string_view path,
+                         const AstarteDatastreamObject& object,
+                         const std::chrono::system_clock::time_point* timestamp)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Set a device property on an interface without blocking.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to set.
+   * @param data The value to set for the property.
+   * @return A future that will hold the result of the operation.
+   */
+  auto set_property_async(std::string_view interface_name, std::string_view path,
+                          const AstarteData& data)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Unset a device property on an interface without blocking.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to unset.
+   * @return A future that will hold the result of the operation.
+   */
+  auto unset_property_async(std::string_view interface_name, std::string_view path)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  /**
+   * @brief Send an individual datastream value to an interface, returning an awaitable.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path within the interface (e.g., "/endpoint/value").
+   * @param data The data point to send.
+   * @param timestamp An optional timestamp for the data point.
+   * @param token The awaitable tag holding the executor for the awaiting coroutine.
+   * @return An awaitable that will hold the result of the operation.
+   */
+  auto send_individual_async(std::string_view interface_name, std::string_view path,
+                             const AstarteData& data,
+                             const std::chrono::system_clock::time_point* timestamp,
+                             const AstarteUseAwaitable& token) -> SendAwaitable;
+  /**
+   * @brief Send a datastream object to an interface, returning an awaitable.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The base path for the object within the interface.
+   * @param object The key-value map representing the object to send.
+   * @param timestamp An optional timestamp for the data.
+   * @param token The awaitable tag holding the executor for the awaiting coroutine.
+   * @return An awaitable that will hold the result of the operation.
+   */
+  auto send_object_async(std::string_view interface_name, std::string_view path,
+                         const AstarteDatastreamObject& object,
+                         const std::chrono::system_clock::time_point* timestamp,
+                         const AstarteUseAwaitable& token) -> SendAwaitable;
+  /**
+   * @brief Set a device property on an interface, returning an awaitable.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to set.
+   * @param data The value to set for the property.
+   * @param token The awaitable tag holding the executor for the awaiting coroutine.
+   * @return An awaitable that will hold the result of the operation.
+   */
+  auto set_property_async(std::string_view interface_name, std::string_view path,
+                          const AstarteData& data, const AstarteUseAwaitable& token)
+      -> SendAwaitable;
+  /**
+   * @brief Unset a device property on an interface, returning an awaitable.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to unset.
+   * @param token The awaitable tag holding the executor for the awaiting coroutine.
+   * @return An awaitable that will hold the result of the operation.
+   */
+  auto unset_property_async(std::string_view interface_name, std::string_view path,
+                            const AstarteUseAwaitable& token) -> SendAwaitable;
+  /**
+   * @brief Wait for the next message received from the message hub.
+   * @details Queued messages are returned immediately, otherwise the awaitable is registered and
+   * completed by the reception thread.
+   * @param token The awaitable tag holding the executor for the awaiting coroutine.
+   * @return An awaitable that will hold the received message.
+   */
+  auto next_message(const AstarteUseAwaitable& token) -> MessageAwaitable;
   /**
    * @brief Poll for a new message received from the message hub.
    * @details This method checks an internal queue for parsed messages from the server.
@@ -136,6 +359,75 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
    * std::nullopt.
    */
   auto poll_incoming(const std::chrono::milliseconds& timeout) -> std::optional<AstarteMessage>;
+  /**
+   * @brief Poll for a batch of messages received from the message hub.
+   * @details Up to max messages are moved from the internal queue with a single lock acquisition.
+   * @param out The vector where the messages are appended.
+   * @param max The maximum number of messages to retrieve.
+   * @param timeout Will block for this timeout if no message is present.
+   * @return The number of messages appended to out.
+   */
+  auto poll_incoming_batch(std::vector<AstarteMessage>& out, std::size_t max,
+                           std::chrono::milliseconds timeout) -> std::size_t;
+  /**
+   * @brief Get a file descriptor readable while received messages are available.
+   * @details The file descriptor is created on the first call.
+   * @return The file descriptor or an error if generated.
+   */
+  auto native_handle() -> astarte_tl::expected<int, AstarteError>;
+  /**
+   * @brief Set a handler invoked by a pool of dispatcher threads for each received message.
+   * @param handler The handler to invoke, an empty handler stops the dispatcher.
+   * @param workers The number of dispatcher threads, should be greater than zero.
+   * @return An error if generated.
+   */
+  auto set_message_handler(AstarteMessageHandler handler, std::size_t workers)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Subscribe a handler to the messages of an interface matching a path pattern.
+   * @details The dispatcher is started if not already running.
+   * @param interface_name The name of the interface.
+   * @param path_pattern The path pattern, parametric segments are in the form %{name}.
+   * @param handler The handler to invoke for the matching messages.
+   * @return The identifier of the subscription or an error if generated.
+   */
+  auto subscribe(std::string_view interface_name, std::string_view path_pattern,
+                 AstarteMessageHandler handler)
+      -> astarte_tl::expected<AstarteSubscriptionId, AstarteError>;
+  /**
+   * @brief Remove a subscription.
+   * @param subscription The identifier of the subscription.
+   * @return An error if generated.
+   */
+  auto unsubscribe(AstarteSubscriptionId subscription) -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Replace the reception queue, keeping the messages already received.
+   * @param type The implementation of the new queue.
+   * @param capacity The maximum number of messages in the queue, zero for an unbounded queue.
+   * @param policy The policy to apply when a message is received with a full queue.
+   * @return An error if generated.
+   */
+  auto set_reception_queue(AstarteReceptionQueue type, std::size_t capacity,
+                           AstarteOverflowPolicy policy)
+      -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Get the number of received messages dropped because of a full reception queue.
+   * @return The number of dropped messages.
+   */
+  auto get_dropped_messages() -> std::uint64_t;
+  /**
+   * @brief Set the number of threads converting the received events.
+   * @param workers The number of decode workers, zero to convert on the reader thread.
+   * @return An error if generated.
+   */
+  auto set_decode_workers(std::size_t workers) -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Subscribe a new consumer to the multicast reception queue.
+   * @return The queue of the consumer or an error if generated.
+   */
+  auto add_message_consumer()
+      -> astarte_tl::expected<std::shared_ptr<MulticastQueue<AstarteMessage>::Subscriber>,
+                              AstarteError>;
   /**
    * @brief Get all stored properties matching the input filter.
    * @param ownership Optional ownership filter.
@@ -160,30 +452,161 @@ struct AstarteDeviceGrpc::AstarteDeviceGrpcImpl {
       -> astarte_tl::expected<AstartePropertyIndividual, AstarteError>;
 
  private:
+  // Prepared endpoints send their cached messages directly
+  friend class AstarteEndpointHandle;
+  // Maximum number of RPCs concurrently in flight for a single batch
+  static constexpr std::ptrdiff_t batch_max_in_flight = 32;
+  // Interval after which the idle sender and replay threads check for a stop request
+  static constexpr int sender_idle_interval_ms = 50;
   // Helper struct to hold the results of the Attach RPC call
   struct AttachResult {
     std::unique_ptr<grpc::ClientContext> context;
     std::unique_ptr<grpc::ClientReader<gRPCMessageHubEvent>> reader;
   };
   void setup_grpc_channel();
+  // The stub of the current connection, kept alive by the caller for the duration of the RPC
+  auto stub() const -> std::shared_ptr<gRPCMessageHub::Stub>;
+  // Updates the connection state, waking up the threads waiting for a connection
+  void set_connected(bool connected);
   auto perform_attach() -> astarte_tl::expected<AttachResult, AstarteError>;
   auto connection_attempt(const std::stop_token& token) -> astarte_tl::expected<void, AstarteError>;
   auto handle_events(const std::stop_token& token, std::unique_ptr<grpc::ClientContext> context,
                      std::unique_ptr<grpc::ClientReader<gRPCMessageHubEvent>> reader)
       -> astarte_tl::expected<void, AstarteError>;
-  static auto parse_message_hub_event(const gRPCMessageHubEvent& event)
+  // Reads the events, converting them on the reader thread
+  auto read_events(const std::stop_token& token,
+                   grpc::ClientReader<gRPCMessageHubEvent>& reader)
+      -> astarte_tl::expected<void, AstarteError>;
+  // An inbound event handed to a decode worker, with the arena it has been parsed on
+  // Copy of the registered interfaces held by the reader, refreshed when the interfaces change,
+  // so that the received messages share the interface strings without locking for each message
+  using InterfacesMap = std::unordered_map<std::string, AstarteInterface>;
+  struct InterfacesSnapshot {
+    std::uint64_t generation{0};
+    std::shared_ptr<const InterfacesMap> interfaces;
+  };
+  void refresh_interfaces(InterfacesSnapshot& snapshot);
+  struct PooledEvent {
+    std::unique_ptr<GrpcMessageArena> arena;
+    gRPCMessageHubEvent* event;
+    std::shared_ptr<const InterfacesMap> interfaces;
+  };
+  // Reads the events, converting them on a pool of decode workers
+  auto read_events_pooled(const std::stop_token& token,
+                          grpc::ClientReader<gRPCMessageHubEvent>& reader)
+      -> astarte_tl::expected<void, AstarteError>;
+  // Pushes a received message to the reception queue, waking up its consumers
+  void publish_message(AstarteMessage message, const std::stop_token& token);
+  // Consumes the event, moving its payloads into the returned message. Messages for one of the
+  // interfaces share its name and non parametric paths.
+  static auto parse_message_hub_event(gRPCMessageHubEvent& event,
+                                      const InterfacesMap* interfaces = nullptr)
       -> astarte_tl::expected<AstarteMessage, AstarteError>;
   auto connection_loop(const std::stop_token& token) -> astarte_tl::expected<void, AstarteError>;
+  // Data is forwarded to the converter, rvalues have their string payloads moved
+  template <typename Data>
+  static auto make_individual_message(GrpcMessageArena* arena, std::string_view interface_name,
+                                      std::string_view path, Data&& data,
+                                      const std::chrono::system_clock::time_point* timestamp)
+      -> gRPCAstarteMessage*;
+  template <typename Object>
+  static auto make_object_message(GrpcMessageArena* arena, std::string_view interface_name,
+                                  std::string_view path, Object&& object,
+                                  const std::chrono::system_clock::time_point* timestamp)
+      -> gRPCAstarteMessage*;
+  static auto make_property_message(GrpcMessageArena* arena, std::string_view interface_name,
+                                    std::string_view path, std::optional<AstarteData> data)
+      -> gRPCAstarteMessage*;
+  auto send_message(const gRPCAstarteMessage& message, const AstarteMapping* mapping = nullptr)
+      -> astarte_tl::expected<void, AstarteError>;
+  // Checks interface, ownership, aggregation, path and data types against the local mapping index
+  auto validate_message(const gRPCAstarteMessage& message,
+                        const AstarteMapping* known_mapping = nullptr)
+      -> astarte_tl::expected<void, AstarteError>;
+  auto transmit_message(const gRPCAstarteMessage& message)
+      -> astarte_tl::expected<void, AstarteError>;
+  // Transmits the message, a datastream failing to be sent is kept for the replay when possible
+  auto transmit_or_store(const gRPCAstarteMessage& message, const AstarteMapping* mapping)
+      -> astarte_tl::expected<void, AstarteError>;
+  // Starts an asynchronous send, failed datastreams are kept for the replay as by the blocking path
+  void start_send_call(const gRPCAstarteMessage& message, GrpcAsyncSendCall::Callback callback);
+  void sender_loop(const std::stop_token& token);
+  void update_rcv_notifier();
+  // Marks the reception queues as in use, after which they can't be replaced
+  void start_reception();
+  // Should be called while holding the dispatcher mutex. The replaced dispatchers are returned,
+  // to be joined once the mutex is released
+  [[nodiscard]] auto restart_dispatcher() -> std::vector<std::unique_ptr<MessageDispatcher>>;
+  static auto make_reception_queue(AstarteReceptionQueue type, std::size_t capacity = 0,
+                                   AstarteOverflowPolicy policy = AstarteOverflowPolicy::kBlock)
+      -> std::unique_ptr<BlockingQueue<AstarteMessage>>;
+  auto buffer_message(const gRPCAstarteMessage& message, const AstarteMapping* mapping = nullptr)
+      -> std::optional<astarte_tl::expected<void, AstarteError>>;
+  // Stores a datastream in the store and forward buffer, std::nullopt if its retention is discard
+  auto store_message(const gRPCAstarteMessage& message, const AstarteMapping* known_mapping)
+      -> std::optional<astarte_tl::expected<void, AstarteError>>;
+  void replay_loop(const std::stop_token& token);
+  void stop_outbound_queue();
+  auto send_message_async(const gRPCAstarteMessage& message)
+      -> std::future<astarte_tl::expected<void, AstarteError>>;
+  void send_message_async(const gRPCAstarteMessage& message, GrpcAsyncSendCall::Callback callback);
+  auto send_message_awaitable(const gRPCAstarteMessage& message, const AstarteUseAwaitable& token)
+      -> SendAwaitable;
+  void complete_rcv_waiters();
+  static void fill_message(const AstarteOutgoingMessage& outgoing, gRPCAstarteMessage* message);
+  auto completion_queue() -> grpc::CompletionQueue*;
+  auto on_completion_queue_thread() -> bool;
 
   std::string server_addr_;
   std::string node_uuid_;
-  std::unique_ptr<gRPCMessageHub::Stub> stub_;
+  // Replaced by each connection attempt while other threads might be using it
+  std::shared_ptr<gRPCMessageHub::Stub> stub_;
+  mutable std::mutex stub_mutex_;
   std::vector<std::string> interfaces_bins_;
+  InterfacesMap interfaces_;
+  // Registered interfaces the SDK could not parse, their messages are left to the message hub
+  std::unordered_set<std::string> unvalidated_interfaces_;
+  std::shared_mutex interfaces_mutex_;
+  std::atomic<std::uint64_t> interfaces_generation_{0};
   std::optional<std::jthread> connection_thread_;
   std::atomic_bool connected_{false};
+  std::mutex connected_mutex_;
+  std::condition_variable_any connected_cv_;
   std::stop_source ssource_;
   std::atomic_bool grpc_stream_error_{false};
-  SharedQueue<AstarteMessage> rcv_queue_;
+  std::unique_ptr<BlockingQueue<AstarteMessage>> rcv_queue_{
+      make_reception_queue(AstarteReceptionQueue::kMultiConsumer)};
+  AstarteReceptionQueue rcv_queue_type_{AstarteReceptionQueue::kMultiConsumer};
+  // Replaces the reception queue when the multicast reception queue is selected
+  std::unique_ptr<MulticastQueue<AstarteMessage>> multicast_queue_;
+  // Maximum number of events queued for each decode worker
+  static constexpr std::size_t decode_queue_capacity = 64;
+  std::size_t decode_workers_{0};
+  // Set by the first use of the reception queues, guarded by the mutex while they are replaced
+  std::mutex rcv_start_mutex_;
+  std::atomic_bool rcv_started_{false};
+  std::mutex rcv_notifier_mutex_;
+  std::unique_ptr<EventNotifier> rcv_notifier_;
+  std::atomic_bool rcv_notifier_enabled_{false};
+  // Coroutines waiting for a message, served in order by the reception thread
+  std::mutex rcv_waiters_mutex_;
+  std::deque<std::shared_ptr<MessageAwaitable::State>> rcv_waiters_;
+  std::atomic<std::size_t> rcv_waiters_count_{0};
+  std::mutex dispatcher_mutex_;
+  std::unique_ptr<MessageDispatcher> dispatcher_;
+  // Dispatchers replaced from one of their own handlers, joined by a later restart
+  std::vector<std::unique_ptr<MessageDispatcher>> retired_dispatchers_;
+  AstarteMessageHandler message_handler_;
+  std::size_t dispatcher_workers_{1};
+  SubscriptionRouter router_;
+  std::once_flag cq_thread_flag_;
+  std::unique_ptr<GrpcCompletionQueueThread> cq_thread_;
+  std::unique_ptr<SharedQueue<gRPCAstarteMessage>> outbound_queue_;
+  std::unique_ptr<StoreForwardBuffer> store_forward_;
+  std::uint32_t replay_rate_{1};
+  std::optional<std::jthread> sender_thread_;
+  // Queued messages whose transmission failed and that could not be stored
+  std::atomic<std::uint64_t> failed_messages_{0};
 };
 
 }  // namespace AstarteDeviceSdk
@@ -0,0 +1,86 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ENDPOINT_HANDLE_IMPL_H
+#define ENDPOINT_HANDLE_IMPL_H
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/endpoint_handle.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "device_grpc_impl.hpp"
+#include "interface.hpp"
+
+namespace AstarteDeviceSdk {
+
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
+
+struct AstarteEndpointHandle::AstarteEndpointHandleImpl {
+  /** @brief Validated state of the endpoint, for a generation of the device interfaces. */
+  struct Endpoint {
+    /** @brief Type of the interface, checked on each transmission. */
+    AstarteInterfaceType type;
+    /** @brief Aggregation of the interface, checked on each transmission. */
+    AstarteAggregation aggregation;
+    /** @brief The mapping matching the endpoint path, shared with the ongoing transmissions. */
+    std::shared_ptr<const AstarteMapping> mapping;
+    /** @brief Generation of the device interfaces the endpoint has been validated against. */
+    std::uint64_t generation;
+  };
+
+  /**
+   * @brief Validate an endpoint and create the shared state of its handles.
+   * @param device The device the endpoint belongs to.
+   * @param interface_name The name of an interface added to the device, owned by the device.
+   * @param path A path matching one of the interface mappings.
+   * @return The shared state of the handles or an error if the endpoint is not valid.
+   */
+  static auto create(const std::shared_ptr<AstarteDeviceGrpc::AstarteDeviceGrpcImpl>& device,
+                     std::string_view interface_name, std::string_view path)
+      -> astarte_tl::expected<std::shared_ptr<AstarteEndpointHandleImpl>, AstarteError>;
+  /**
+   * @brief Validate an endpoint against the interfaces currently added to the device.
+   * @param device The device the endpoint belongs to.
+   * @param interface_name The name of an interface added to the device, owned by the device.
+   * @param path A path matching one of the interface mappings.
+   * @return The validated endpoint or an error if the endpoint is not valid.
+   */
+  static auto resolve(AstarteDeviceGrpc::AstarteDeviceGrpcImpl& device,
+                      std::string_view interface_name, std::string_view path)
+      -> astarte_tl::expected<Endpoint, AstarteError>;
+
+  /** @brief The device the endpoint belongs to. */
+  std::weak_ptr<AstarteDeviceGrpc::AstarteDeviceGrpcImpl> device;
+  /** @brief The interface name of the endpoint. */
+  std::string interface_name;
+  /** @brief The path of the endpoint. */
+  std::string path;
+  /** @brief Guards the endpoint and the idle messages. */
+  std::mutex mutex;
+  /** @brief The endpoint, validated again when the interfaces of the device change. */
+  Endpoint endpoint;
+  /**
+   * @brief Messages with interface name and path set once, not used by any transmission.
+   * @details Payloads are overwritten in place, each concurrent transmission takes its own.
+   */
+  std::vector<std::unique_ptr<gRPCAstarteMessage>> idle_messages;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ENDPOINT_HANDLE_IMPL_H
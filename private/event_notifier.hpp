@@ -0,0 +1,62 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef EVENT_NOTIFIER_H
+#define EVENT_NOTIFIER_H
+
+#include <memory>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Pollable file descriptor used to signal events to an external event loop.
+ * @details Backed by an eventfd on Linux and by a pipe on the other POSIX systems. The descriptor
+ * becomes readable after a call to signal and stays readable until a call to clear.
+ */
+class EventNotifier {
+ public:
+  /**
+   * @brief Create a new event notifier.
+   * @return The event notifier or an error if the platform does not support it.
+   */
+  static auto create() -> astarte_tl::expected<std::unique_ptr<EventNotifier>, AstarteError>;
+  /** @brief Destructor, closing the file descriptors. */
+  ~EventNotifier();
+  /** @brief Copy constructor for the event notifier. */
+  EventNotifier(const EventNotifier&) = delete;
+  /** @brief Move constructor for the event notifier. */
+  EventNotifier(EventNotifier&&) = delete;
+  /** @brief Copy assignment operator for the event notifier. */
+  auto operator=(const EventNotifier&) -> EventNotifier& = delete;
+  /** @brief Move assignment operator for the event notifier. */
+  auto operator=(EventNotifier&&) -> EventNotifier& = delete;
+
+  /**
+   * @brief Get the file descriptor to wait on for readability.
+   * @return The file descriptor.
+   */
+  [[nodiscard]] auto native_handle() const -> int;
+  /** @brief Make the file descriptor readable. */
+  void signal();
+  /** @brief Make the file descriptor not readable, consuming all the pending signals. */
+  void clear();
+
+ private:
+  EventNotifier(int read_fd, int write_fd);
+
+  int read_fd_;
+  int write_fd_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // EVENT_NOTIFIER_H
@@ -0,0 +1,136 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef GRPC_ARENA_H
+#define GRPC_ARENA_H
+
+#include <google/protobuf/arena.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief A protobuf arena with an inline initial block.
+ * @details Messages created from this arena are released all at once on reset or destruction.
+ * As long as the messages fit in the initial block, no heap allocation is performed. Resetting
+ * keeps the initial block, so an arena reused in a loop does not allocate in steady state.
+ * This class is not thread safe.
+ */
+class GrpcMessageArena {
+ public:
+  /** @brief Size in bytes of the inline initial block. */
+  static constexpr std::size_t initial_block_size = 4096;
+
+  /** @brief Create a new arena. */
+  GrpcMessageArena() : arena_(arena_options(block_.data())) {}
+  /** @brief Copy constructor. */
+  GrpcMessageArena(const GrpcMessageArena& other) = delete;
+  /** @brief Move constructor. */
+  GrpcMessageArena(GrpcMessageArena&& other) = delete;
+  /** @brief Copy assignment operator. */
+  auto operator=(const GrpcMessageArena& other) -> GrpcMessageArena& = delete;
+  /** @brief Move assignment operator. */
+  auto operator=(GrpcMessageArena&& other) -> GrpcMessageArena& = delete;
+  /** @brief Destructor. */
+  ~GrpcMessageArena() = default;
+
+  /**
+   * @brief Create a new message on the arena.
+   * @return The new message, valid until the next reset.
+   */
+  template <typename T>
+  auto create() -> T* {
+    return google::protobuf::Arena::CreateMessage<T>(&arena_);
+  }
+  /** @brief Release all the messages created from this arena. */
+  void reset() { arena_.Reset(); }
+  /**
+   * @brief Get the total number of bytes allocated by the arena.
+   * @return The number of allocated bytes, including the initial block.
+   */
+  [[nodiscard]] auto space_allocated() const -> std::size_t {
+    return static_cast<std::size_t>(arena_.SpaceAllocated());
+  }
+
+ private:
+  static auto arena_options(char* block) -> google::protobuf::ArenaOptions {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = initial_block_size;
+    return options;
+  }
+
+  // Left uninitialized, the arena never reads memory it has not written
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  alignas(std::max_align_t) std::array<char, initial_block_size> block_;
+  google::protobuf::Arena arena_;
+};
+
+/**
+ * @brief Scoped access to an arena reused by all the sends of the calling thread.
+ * @details The arena of the thread is reset when the lease ends, so the messages created from it
+ * are only valid for the lifetime of the lease. A lease taken while another one is active on the
+ * same thread gets a new arena of its own.
+ */
+class GrpcArenaLease {
+ public:
+  /** @brief Take the arena of the calling thread, or a new one if it's already leased. */
+  GrpcArenaLease() {
+    State& state = thread_state();
+    if (!state.leased) {
+      state.leased = true;
+      arena_ = &state.arena;
+    } else {
+      fallback_ = std::make_unique<GrpcMessageArena>();
+      arena_ = fallback_.get();
+    }
+  }
+  /** @brief Copy constructor. */
+  GrpcArenaLease(const GrpcArenaLease& other) = delete;
+  /** @brief Move constructor. */
+  GrpcArenaLease(GrpcArenaLease&& other) = delete;
+  /** @brief Copy assignment operator. */
+  auto operator=(const GrpcArenaLease& other) -> GrpcArenaLease& = delete;
+  /** @brief Move assignment operator. */
+  auto operator=(GrpcArenaLease&& other) -> GrpcArenaLease& = delete;
+  /** @brief Reset the arena of the thread and release it. */
+  ~GrpcArenaLease() {
+    if (!fallback_) {
+      State& state = thread_state();
+      state.arena.reset();
+      state.leased = false;
+    }
+  }
+
+  /**
+   * @brief Get the leased arena.
+   * @return The arena, valid until the end of the lease.
+   */
+  [[nodiscard]] auto get() const -> GrpcMessageArena* { return arena_; }
+  /**
+   * @brief Access the leased arena.
+   * @return The arena, valid until the end of the lease.
+   */
+  auto operator->() const -> GrpcMessageArena* { return arena_; }
+
+ private:
+  struct State {
+    GrpcMessageArena arena;
+    bool leased{false};
+  };
+  static auto thread_state() -> State& {
+    thread_local State state;
+    return state;
+  }
+
+  std::unique_ptr<GrpcMessageArena> fallback_;
+  GrpcMessageArena* arena_{nullptr};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // GRPC_ARENA_H
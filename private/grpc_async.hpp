@@ -0,0 +1,123 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef GRPC_ASYNC_H
+#define GRPC_ASYNC_H
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/grpcpp.h>
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "astarte_device_sdk/errors.hpp"
+
+namespace AstarteDeviceSdk {
+
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
+using gRPCMessageHub = astarteplatform::msghub::MessageHub;
+
+/**
+ * @brief Base class for all the operations posted to a gRPC completion queue.
+ * @details Instances of derived classes are used as tags for the completion queue. When the
+ * operation completes the completion queue thread will call the complete method.
+ */
+class GrpcAsyncOperation {
+ public:
+  /** @brief Virtual destructor. */
+  virtual ~GrpcAsyncOperation() = default;
+  /**
+   * @brief Called by the completion queue thread once the operation has completed.
+   * @details Implementations are responsible of releasing the operation.
+   * @param ok The status flag returned by the completion queue.
+   */
+  virtual void complete(bool ok) = 0;
+
+ protected:
+  /** @brief Protected default constructor. */
+  GrpcAsyncOperation() = default;
+  /** @brief Copy constructor. */
+  GrpcAsyncOperation(const GrpcAsyncOperation& other) = delete;
+  /** @brief Move constructor. */
+  GrpcAsyncOperation(GrpcAsyncOperation&& other) = delete;
+  /** @brief Copy assignment operator. */
+  auto operator=(const GrpcAsyncOperation& other) -> GrpcAsyncOperation& = delete;
+  /** @brief Move assignment operator. */
+  auto operator=(GrpcAsyncOperation&& other) -> GrpcAsyncOperation& = delete;
+};
+
+/**
+ * @brief A gRPC completion queue polled by a dedicated thread.
+ * @details All the tags posted to the queue should be instances of GrpcAsyncOperation.
+ */
+class GrpcCompletionQueueThread {
+ public:
+  /** @brief Create the completion queue and start the polling thread. */
+  GrpcCompletionQueueThread();
+  /** @brief Shut down the completion queue, waiting for all pending operations to complete. */
+  ~GrpcCompletionQueueThread();
+  /** @brief Copy constructor. */
+  GrpcCompletionQueueThread(const GrpcCompletionQueueThread& other) = delete;
+  /** @brief Move constructor. */
+  GrpcCompletionQueueThread(GrpcCompletionQueueThread&& other) = delete;
+  /** @brief Copy assignment operator. */
+  auto operator=(const GrpcCompletionQueueThread& other) -> GrpcCompletionQueueThread& = delete;
+  /** @brief Move assignment operator. */
+  auto operator=(GrpcCompletionQueueThread&& other) -> GrpcCompletionQueueThread& = delete;
+  /**
+   * @brief Get the completion queue.
+   * @return The completion queue polled by this thread.
+   */
+  auto queue() -> grpc::CompletionQueue*;
+  /**
+   * @brief Check if the caller is running on the polling thread, as the completion callbacks do.
+   * @return True when called from the polling thread.
+   */
+  [[nodiscard]] auto is_current() const -> bool;
+
+ private:
+  void run();
+
+  grpc::CompletionQueue cq_;
+  std::thread thread_;
+};
+
+/** @brief An asynchronous unary Send RPC to the message hub. */
+class GrpcAsyncSendCall : public GrpcAsyncOperation {
+ public:
+  /** @brief Callback type invoked with the result of the RPC. */
+  using Callback = std::function<void(astarte_tl::expected<void, AstarteError>)>;
+  /**
+   * @brief Start a new asynchronous Send RPC.
+   * @details The message is serialized before this function returns, it does not need to outlive
+   * the call. The callback will be invoked from the completion queue thread.
+   * @param stub The message hub stub to use for the RPC.
+   * @param cq The completion queue to use for the RPC.
+   * @param message The message to send.
+   * @param callback The callback to invoke on completion.
+   */
+  static void start(gRPCMessageHub::Stub* stub, grpc::CompletionQueue* cq,
+                    const gRPCAstarteMessage& message, Callback callback);
+  /**
+   * @brief Invoke the user callback with the RPC result and release this object.
+   * @param ok The status flag returned by the completion queue.
+   */
+  void complete(bool ok) override;
+
+ private:
+  explicit GrpcAsyncSendCall(Callback callback);
+
+  grpc::ClientContext context_;
+  google::protobuf::Empty response_;
+  grpc::Status status_;
+  std::unique_ptr<grpc::ClientAsyncResponseReader<google::protobuf::Empty>> reader_;
+  Callback callback_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // GRPC_ASYNC_H
@@ -11,6 +11,7 @@
 #include <astarteplatform/msghub/property.pb.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -19,13 +20,16 @@
 #include <vector>
 
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/errors.hpp"
 #include "astarte_device_sdk/individual.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/series.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
+#include "interface.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -63,19 +67,60 @@ class GrpcConverterTo {
       -> std::unique_ptr<gRPCAstarteDatastreamObject>;
   auto operator()(const std::optional<AstarteData>& value)
       -> std::unique_ptr<gRPCAstartePropertyIndividual>;
+
+  // The fill functions write into existing messages. Nested messages are allocated on the arena
+  // of the target message, if any, and previous content of the target is overwritten.
+  // The rvalue overloads move string payloads into the target message instead of copying them.
+  static void fill(const AstarteData& value, gRPCAstarteData* grpc_data);
+  static void fill(AstarteData&& value, gRPCAstarteData* grpc_data);
+  static void fill(const AstarteData& value, const std::chrono::system_clock::time_point* timestamp,
+                   gRPCAstarteDatastreamIndividual* grpc_individual);
+  static void fill(AstarteData&& value, const std::chrono::system_clock::time_point* timestamp,
+                   gRPCAstarteDatastreamIndividual* grpc_individual);
+  static void fill(const AstarteDataView& value, gRPCAstarteData* grpc_data);
+  static void fill(const AstarteDataView& value,
+                   const std::chrono::system_clock::time_point* timestamp,
+                   gRPCAstarteDatastreamIndividual* grpc_individual);
+  static void fill(const AstarteDatastreamObject& value,
+                   const std::chrono::system_clock::time_point* timestamp,
+                   gRPCAstarteDatastreamObject* grpc_object);
+  static void fill(AstarteDatastreamObject&& value,
+                   const std::chrono::system_clock::time_point* timestamp,
+                   gRPCAstarteDatastreamObject* grpc_object);
+  // Writes the sample at the given index of the series, with its timestamp
+  static void fill(const AstarteDatastreamSeries& series, std::size_t index,
+                   gRPCAstarteDatastreamIndividual* grpc_individual);
+  static void fill(const std::optional<AstarteData>& value,
+                   gRPCAstartePropertyIndividual* grpc_property);
+  static void fill(std::optional<AstarteData>&& value,
+                   gRPCAstartePropertyIndividual* grpc_property);
 };
 
 class GrpcConverterFrom {
  public:
+  // The rvalue overloads consume the gRPC message, moving its strings into the converted value
+  // instead of copying them. The gRPC message is left in a valid but unspecified state.
   auto operator()(const gRPCAstarteData& value) -> astarte_tl::expected<AstarteData, AstarteError>;
+  auto operator()(gRPCAstarteData&& value) -> astarte_tl::expected<AstarteData, AstarteError>;
   auto operator()(const gRPCAstarteDatastreamIndividual& value)
       -> astarte_tl::expected<AstarteDatastreamIndividual, AstarteError>;
+  auto operator()(gRPCAstarteDatastreamIndividual&& value)
+      -> astarte_tl::expected<AstarteDatastreamIndividual, AstarteError>;
   auto operator()(const gRPCAstarteDatastreamObject& value)
       -> astarte_tl::expected<AstarteDatastreamObject, AstarteError>;
+  auto operator()(gRPCAstarteDatastreamObject&& value)
+      -> astarte_tl::expected<AstarteDatastreamObject, AstarteError>;
   auto operator()(const gRPCAstartePropertyIndividual& value)
       -> astarte_tl::expected<AstartePropertyIndividual, AstarteError>;
+  auto operator()(gRPCAstartePropertyIndividual&& value)
+      -> astarte_tl::expected<AstartePropertyIndividual, AstarteError>;
   auto operator()(const gRPCAstarteMessage& value)
       -> astarte_tl::expected<AstarteMessage, AstarteError>;
+  auto operator()(gRPCAstarteMessage&& value)
+      -> astarte_tl::expected<AstarteMessage, AstarteError>;
+  // The converted message shares the name and the non parametric paths of the interface
+  auto operator()(gRPCAstarteMessage&& value, const AstarteInterface& interface)
+      -> astarte_tl::expected<AstarteMessage, AstarteError>;
   auto operator()(const gRPCOwnership& value) -> AstarteOwnership;
   auto operator()(const gRPCStoredProperties& value)
       -> astarte_tl::expected<std::list<AstarteStoredProperty>, AstarteError>;
@@ -0,0 +1,192 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef INTERFACE_H
+#define INTERFACE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/interned_string.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+/** @brief Possible Astarte interface types. */
+enum AstarteInterfaceType : int8_t {
+  /** @brief Datastream interface. */
+  kDatastream,
+  /** @brief Properties interface. */
+  kProperties
+};
+
+/** @brief Possible Astarte interface aggregations. */
+enum AstarteAggregation : int8_t {
+  /** @brief Each mapping is sent independently. */
+  kIndividual,
+  /** @brief All the mappings are sent together as an object. */
+  kObject
+};
+
+/** @brief Possible retention policies for the datastream mappings. */
+enum AstarteRetention : int8_t {
+  /** @brief Data is discarded if it can't be sent. */
+  kDiscard,
+  /** @brief Data is kept in memory until it can be sent. */
+  kVolatile,
+  /** @brief Data is kept on persistent storage until it can be sent. */
+  kStored
+};
+
+/** @brief A single mapping of an Astarte interface. */
+struct AstarteMapping {
+  /** @brief The mapping endpoint, might contain parameters in the form %{name}. */
+  std::string endpoint;
+  /** @brief The type of the mapping. */
+  AstarteType type;
+  /** @brief The retention policy of the mapping. */
+  AstarteRetention retention;
+  /** @brief Expiry of the retained data, zero means the data never expires. */
+  std::chrono::seconds expiry;
+  /** @brief True if the data for the mapping should be sent with a timestamp. */
+  bool explicit_timestamp;
+
+  /**
+   * @brief Check if a path matches the endpoint of this mapping.
+   * @param path The path to check.
+   * @return True if the path matches the endpoint, false otherwise.
+   */
+  [[nodiscard]] auto matches(std::string_view path) const -> bool;
+};
+
+/**
+ * @brief An Astarte interface, parsed from its JSON definition.
+ * @details The mapping endpoints are indexed in a trie of path segments, where a segment in the
+ * form %{name} matches any non-empty segment. Literal segments take precedence, a lookup falls
+ * back to the parameter when the literal branch has no match. Lookups cost O(path length) when no
+ * literal segment overlaps a parameter at the same position, otherwise each node of the index is
+ * visited at most once. The index is shared between the copies of the interface.
+ */
+class AstarteInterface {
+ public:
+  /**
+   * @brief Parse an interface from its JSON definition.
+   * @param json The JSON definition of the interface.
+   * @return The parsed interface or an error if the definition is invalid.
+   */
+  static auto create(std::string_view json) -> astarte_tl::expected<AstarteInterface, AstarteError>;
+  /**
+   * @brief Read only the name from the JSON definition of an interface.
+   * @param json The JSON definition of the interface, possibly not a valid interface.
+   * @return The interface name, or std::nullopt if the JSON has no string interface_name.
+   */
+  static auto parse_name(std::string_view json) -> std::optional<std::string>;
+
+  /** @return The interface name. */
+  [[nodiscard]] auto name() const -> const std::string&;
+  /** @return The interface major version. */
+  [[nodiscard]] auto version_major() const -> int32_t;
+  /** @return The interface minor version. */
+  [[nodiscard]] auto version_minor() const -> int32_t;
+  /** @return The interface type. */
+  [[nodiscard]] auto type() const -> AstarteInterfaceType;
+  /** @return The interface ownership. */
+  [[nodiscard]] auto ownership() const -> AstarteOwnership;
+  /** @return The interface aggregation. */
+  [[nodiscard]] auto aggregation() const -> AstarteAggregation;
+  /** @return The interface mappings. */
+  [[nodiscard]] auto mappings() const -> const std::vector<AstarteMapping>&;
+  /**
+   * @brief Find the mapping to use for a message sent on the path.
+   * @details For object aggregated interfaces the path is the common path of the object and the
+   * first mapping is returned, all the mappings of an object share the same retention.
+   * @param path The path of the message.
+   * @return A pointer to the mapping, or nullptr if no mapping matches the path.
+   */
+  [[nodiscard]] auto find_mapping(std::string_view path) const -> const AstarteMapping*;
+  /**
+   * @brief Find the mapping of a field of an object sent on the path.
+   * @param path The common path of the object.
+   * @param field The key of the field in the object, the last segment of the mapping endpoint.
+   * @return A pointer to the mapping, or nullptr if the interface is not object aggregated or
+   * no mapping matches.
+   */
+  [[nodiscard]] auto find_object_field(std::string_view path, std::string_view field) const
+      -> const AstarteMapping*;
+  /**
+   * @brief Get a handle to the interface name, shared by all the copies of the interface.
+   * @return The handle to the name.
+   */
+  [[nodiscard]] auto name_handle() const -> AstarteInternedString;
+  /**
+   * @brief Get a handle to a path of the interface.
+   * @details The paths of the non parametric mappings, or the common paths of the objects for
+   * object aggregated interfaces, share the copy held by the interface. Other paths are moved into
+   * a new handle.
+   * @param path The path of a message for the interface.
+   * @return The handle to the path.
+   */
+  [[nodiscard]] auto path_handle(std::string&& path) const -> AstarteInternedString;
+
+ private:
+  AstarteInterface() = default;
+
+  struct StringHash {
+    using is_transparent = void;
+    auto operator()(std::string_view str) const -> std::size_t {
+      return std::hash<std::string_view>{}(str);
+    }
+  };
+  template <typename T>
+  using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+  // Mappings are referenced by their index, so that copies of the interface can share the index
+  struct MappingNode {
+    StringMap<MappingNode> children;
+    std::unique_ptr<MappingNode> parameter;
+    std::optional<std::size_t> mapping;
+    // Object aggregated interfaces only, mappings of the fields of the object with this path
+    StringMap<std::size_t> fields;
+  };
+
+  // Copies of the name and of the non parametric paths, shared by the received messages
+  struct SharedNames {
+    std::shared_ptr<const std::string> name;
+    StringMap<std::shared_ptr<const std::string>> paths;
+  };
+
+  void build_index();
+  void build_shared_names();
+  [[nodiscard]] auto find_node(std::string_view path) const -> const MappingNode*;
+
+  std::string name_;
+  int32_t version_major_{0};
+  int32_t version_minor_{0};
+  AstarteInterfaceType type_{AstarteInterfaceType::kDatastream};
+  AstarteOwnership ownership_{AstarteOwnership::kDevice};
+  AstarteAggregation aggregation_{AstarteAggregation::kIndividual};
+  std::vector<AstarteMapping> mappings_;
+  std::shared_ptr<const MappingNode> index_;
+  std::shared_ptr<const SharedNames> shared_names_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // INTERFACE_H
@@ -0,0 +1,44 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef MESSAGE_CONSUMER_IMPL_H
+#define MESSAGE_CONSUMER_IMPL_H
+
+#include <memory>
+
+#include "astarte_device_sdk/message_consumer.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "multicast_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+struct AstarteMessageConsumer::AstarteMessageConsumerImpl {
+  /**
+   * @brief Construct the shared state of a consumer.
+   * @param queue The queue of the consumer, returned by MulticastQueue::subscribe.
+   */
+  explicit AstarteMessageConsumerImpl(
+      std::shared_ptr<MulticastQueue<AstarteMessage>::Subscriber> queue);
+  /**
+   * @brief Destructor, releasing the queue.
+   * @details Pending messages are discarded, unblocking a reception thread waiting on the full
+   * queue of this consumer.
+   */
+  ~AstarteMessageConsumerImpl();
+  /** @brief Copy constructor for the consumer state. */
+  AstarteMessageConsumerImpl(const AstarteMessageConsumerImpl&) = delete;
+  /** @brief Move constructor for the consumer state. */
+  AstarteMessageConsumerImpl(AstarteMessageConsumerImpl&&) = delete;
+  /** @brief Copy assignment operator for the consumer state. */
+  auto operator=(const AstarteMessageConsumerImpl&) -> AstarteMessageConsumerImpl& = delete;
+  /** @brief Move assignment operator for the consumer state. */
+  auto operator=(AstarteMessageConsumerImpl&&) -> AstarteMessageConsumerImpl& = delete;
+
+  /** @brief The queue of the consumer, shared with the multicast queue of the device. */
+  std::shared_ptr<MulticastQueue<AstarteMessage>::Subscriber> queue;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // MESSAGE_CONSUMER_IMPL_H
@@ -0,0 +1,68 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef MESSAGE_DISPATCHER_H
+#define MESSAGE_DISPATCHER_H
+
+#include <cstddef>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/message_handler.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "blocking_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Pool of threads delivering the received messages to a message handler.
+ * @details Each worker blocks on the reception queue and invokes the handler as soon as a message
+ * is available. With more than one worker, messages may be handled concurrently and out of order.
+ */
+class MessageDispatcher {
+ public:
+  /**
+   * @brief Construct a new dispatcher, starting its workers.
+   * @param queue The reception queue, should outlive the dispatcher.
+   * @param handler The handler to invoke for each message.
+   * @param workers The number of worker threads, should be greater than zero.
+   */
+  MessageDispatcher(BlockingQueue<AstarteMessage>& queue, AstarteMessageHandler handler,
+                    std::size_t workers);
+  /** @brief Destructor, stopping and joining all the workers. */
+  ~MessageDispatcher();
+  /** @brief Copy constructor for the message dispatcher. */
+  MessageDispatcher(const MessageDispatcher&) = delete;
+  /** @brief Move constructor for the message dispatcher. */
+  MessageDispatcher(MessageDispatcher&&) = delete;
+  /** @brief Copy assignment operator for the message dispatcher. */
+  auto operator=(const MessageDispatcher&) -> MessageDispatcher& = delete;
+  /** @brief Move assignment operator for the message dispatcher. */
+  auto operator=(MessageDispatcher&&) -> MessageDispatcher& = delete;
+
+  /**
+   * @brief Request all the workers to stop, without joining them.
+   * @details Workers stop once their current handler returns.
+   */
+  void request_stop();
+  /**
+   * @brief Check if the calling thread is one of the workers.
+   * @return True when called from a handler invoked by this dispatcher.
+   */
+  [[nodiscard]] auto runs_on_current_thread() const -> bool;
+
+ private:
+  // Maximum time a worker waits on the queue before checking for a stop request
+  static constexpr int idle_interval_ms = 100;
+  void worker_loop(const std::stop_token& token);
+
+  BlockingQueue<AstarteMessage>& queue_;
+  AstarteMessageHandler handler_;
+  std::vector<std::jthread> workers_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // MESSAGE_DISPATCHER_H
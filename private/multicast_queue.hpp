@@ -0,0 +1,130 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef MULTICAST_QUEUE_H
+#define MULTICAST_QUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "shared_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Queue delivering each pushed item to all of its subscribers.
+ * @details A pushed item is moved once into an immutable shared item, that is then pushed into the
+ * bounded queue of each subscriber. Subscribers are tracked through weak references and are
+ * removed once released. Items are consumed only through the subscriber queues, so this is not a
+ * BlockingQueue and has no pop functions.
+ */
+template <typename T>
+class MulticastQueue {
+ public:
+  /** @brief The queue of a single subscriber. */
+  using Subscriber = SharedQueue<std::shared_ptr<const T>>;
+
+  /**
+   * @brief Construct a new multicast queue.
+   * @param capacity The maximum number of items in the queue of each subscriber, zero for
+   * unbounded queues.
+   * @param policy The policy to apply when pushing to the full queue of a subscriber. With the
+   * kBlock policy, a slow subscriber stops the delivery to all the others.
+   */
+  explicit MulticastQueue(std::size_t capacity = 0,
+                          AstarteOverflowPolicy policy = AstarteOverflowPolicy::kBlock)
+      : capacity_(capacity), policy_(policy) {}
+
+  /**
+   * @brief Add a subscriber, receiving the items pushed from now on.
+   * @return The queue of the subscriber, it's removed from the subscribers once released.
+   */
+  auto subscribe() -> std::shared_ptr<Subscriber> {
+    auto subscriber = std::make_shared<Subscriber>(capacity_, policy_);
+    const std::lock_guard<std::mutex> lock(mutex_);
+    subscribers_.push_back(subscriber);
+    return subscriber;
+  }
+  /**
+   * @brief Get the number of subscribers.
+   * @return The number of subscribers still referenced.
+   */
+  auto subscribers() -> std::size_t {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return std::count_if(subscribers_.begin(), subscribers_.end(),
+                         [](const auto& subscriber) { return !subscriber.expired(); });
+  }
+
+  /**
+   * @brief Push a new item to all the subscribers.
+   * @details The overflow policy is applied to the queue of each subscriber. With the kBlock policy
+   * the producer waits for space in the queue of each subscriber or for a stop request.
+   * @param item The item to push.
+   * @param token Stop token interrupting a blocked push.
+   * @return False if the item has not been delivered to any subscriber, true otherwise.
+   */
+  auto push(T item, const std::stop_token& token = std::stop_token()) -> bool {
+    // Producers are serialized, so the list of targets can be reused across pushes
+    const std::lock_guard<std::mutex> push_lock(push_mutex_);
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      std::erase_if(subscribers_, [this](const auto& weak) {
+        auto subscriber = weak.lock();
+        if (!subscriber) {
+          return true;
+        }
+        targets_.push_back(std::move(subscriber));
+        return false;
+      });
+    }
+    if (targets_.empty()) {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      dropped_++;
+      return false;
+    }
+
+    const std::shared_ptr<const T> shared = std::make_shared<const T>(std::move(item));
+    std::size_t delivered = 0;
+    for (const auto& target : targets_) {
+      if (target->push(shared, token)) {
+        delivered++;
+      }
+    }
+    if (delivered != targets_.size()) {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      dropped_++;
+    }
+    targets_.clear();
+    return delivered != 0;
+  }
+  /**
+   * @brief Get the number of items not delivered to at least one subscriber.
+   * @details Includes the items pushed while there were no subscribers.
+   * @return The number of dropped items.
+   */
+  auto dropped() -> std::uint64_t {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+ private:
+  std::size_t capacity_;
+  AstarteOverflowPolicy policy_;
+  std::mutex mutex_;
+  std::vector<std::weak_ptr<Subscriber>> subscribers_;
+  std::uint64_t dropped_{0};
+  std::mutex push_mutex_;
+  std::vector<std::shared_ptr<Subscriber>> targets_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // MULTICAST_QUEUE_H
@@ -0,0 +1,106 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ORDERED_WORKER_POOL_H
+#define ORDERED_WORKER_POOL_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "shared_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Pool of threads processing items concurrently while preserving the order of each key.
+ * @details Each worker owns a bounded queue. Items are assigned to a worker by their key, so items
+ * with the same key are processed sequentially in submission order, while items with different
+ * keys may be processed concurrently and out of order.
+ */
+template <typename T>
+class OrderedWorkerPool {
+ public:
+  /** @brief The function processing an item on a worker thread. */
+  using Process = std::function<void(T&&)>;
+
+  /**
+   * @brief Construct a new pool, starting its workers.
+   * @param workers The number of worker threads, should be greater than zero.
+   * @param capacity The maximum number of items queued for each worker, zero for unbounded queues.
+   * @param process The function processing each item.
+   */
+  OrderedWorkerPool(std::size_t workers, std::size_t capacity, Process process)
+      : process_(std::move(process)) {
+    queues_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+      queues_.push_back(std::make_unique<SharedQueue<T>>(capacity, AstarteOverflowPolicy::kBlock));
+    }
+    workers_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+      workers_.emplace_back([this, i](const std::stop_token& token) { worker_loop(token, i); });
+    }
+  }
+  /** @brief Destructor, processing all the submitted items and joining the workers. */
+  ~OrderedWorkerPool() {
+    // Stop all the workers at once, jthread's destructor will then join them
+    for (auto& worker : workers_) {
+      worker.request_stop();
+    }
+  }
+  /** @brief Copy constructor for the worker pool. */
+  OrderedWorkerPool(const OrderedWorkerPool&) = delete;
+  /** @brief Move constructor for the worker pool. */
+  OrderedWorkerPool(OrderedWorkerPool&&) = delete;
+  /** @brief Copy assignment operator for the worker pool. */
+  auto operator=(const OrderedWorkerPool&) -> OrderedWorkerPool& = delete;
+  /** @brief Move assignment operator for the worker pool. */
+  auto operator=(OrderedWorkerPool&&) -> OrderedWorkerPool& = delete;
+
+  /**
+   * @brief Submit an item, blocking while the queue of its worker is full.
+   * @param key The ordering key of the item, usually a hash.
+   * @param item The item to process.
+   * @param token Interrupts the wait on a full queue, dropping the item.
+   * @return False if the item has been dropped, true otherwise.
+   */
+  auto submit(std::size_t key, T item, const std::stop_token& token) -> bool {
+    return queues_[key % queues_.size()]->push(std::move(item), token);
+  }
+
+ private:
+  // Maximum time a worker waits on its queue before checking for a stop request
+  static constexpr int idle_interval_ms = 100;
+  // Maximum number of items taken from the queue at once
+  static constexpr std::size_t queue_batch = 16;
+
+  void worker_loop(const std::stop_token& token, std::size_t index) {
+    SharedQueue<T>& queue = *queues_[index];
+    std::vector<T> items;
+    // Once stopped the pending items are still processed
+    while (!token.stop_requested() || !queue.empty()) {
+      if (queue.pop_batch(items, queue_batch, std::chrono::milliseconds(idle_interval_ms)) == 0) {
+        continue;
+      }
+      for (T& item : items) {
+        process_(std::move(item));
+      }
+      items.clear();
+    }
+  }
+
+  Process process_;
+  std::vector<std::unique_ptr<SharedQueue<T>>> queues_;
+  std::vector<std::jthread> workers_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ORDERED_WORKER_POOL_H
@@ -0,0 +1,115 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SEGMENT_LOG_H
+#define SEGMENT_LOG_H
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Append only log of records, split in multiple segment files on disk.
+ * @details Records are read back in insertion order. Fully consumed segments are deleted, the
+ * one being written included. The read position is persisted in a cursor file next to the
+ * segments at each pop, so records consumed before a restart are not read again.
+ * This class is not thread safe.
+ */
+class SegmentLog {
+ public:
+  /** @brief A single record of the log. */
+  struct Record {
+    /** @brief Sequence number of the record, assigned by the user. */
+    std::uint64_t seq;
+    /** @brief Expiry time of the record as milliseconds since the epoch, zero for no expiry. */
+    std::int64_t expiry_ms;
+    /** @brief The record content. */
+    std::string payload;
+  };
+
+  /**
+   * @brief Open a log in the given directory, creating it if it does not exist.
+   * @details Segments already present in the directory are loaded and will be read first.
+   * @param dir The directory containing the segment files.
+   * @param segment_size Size in bytes after which a new segment is started.
+   * @param max_size Maximum size in bytes of all the segments, oldest segments are removed when
+   * exceeded.
+   * @return The opened log or an error.
+   */
+  static auto open(const std::filesystem::path& dir, std::uintmax_t segment_size,
+                   std::uintmax_t max_size) -> astarte_tl::expected<SegmentLog, AstarteError>;
+
+  /**
+   * @brief Append a record at the end of the log.
+   * @param record The record to append.
+   * @return An error if the record could not be written.
+   */
+  auto append(const Record& record) -> astarte_tl::expected<void, AstarteError>;
+  /**
+   * @brief Read the oldest record in the log, without removing it.
+   * @return A pointer to the oldest record, valid until the next call to pop, or nullptr if the
+   * log is empty.
+   */
+  auto front() -> const Record*;
+  /** @brief Remove the oldest record from the log. */
+  void pop();
+  /**
+   * @brief Check if the log has no records left to read.
+   * @return True if the log is empty, false otherwise.
+   */
+  auto empty() -> bool;
+  /**
+   * @brief Get the sequence number of the last record written in the log.
+   * @return The sequence number, or std::nullopt if no record has ever been written.
+   */
+  [[nodiscard]] auto last_seq() const -> std::optional<std::uint64_t>;
+
+ private:
+  struct Segment {
+    std::uint64_t index;
+    std::filesystem::path path;
+    std::uintmax_t size;
+  };
+
+  SegmentLog(std::filesystem::path dir, std::uintmax_t segment_size, std::uintmax_t max_size);
+  static auto read_record(std::ifstream& stream, std::uintmax_t available)
+      -> std::optional<Record>;
+  static auto read_cursor(const std::filesystem::path& path)
+      -> std::optional<std::pair<std::uint64_t, std::uintmax_t>>;
+  void write_cursor();
+  auto start_segment() -> astarte_tl::expected<void, AstarteError>;
+  void drop_front_segment();
+  void enforce_max_size();
+
+  std::filesystem::path dir_;
+  std::filesystem::path cursor_path_;
+  std::uintmax_t segment_size_;
+  std::uintmax_t max_size_;
+  std::deque<Segment> segments_;
+  std::uint64_t next_index_{0};
+  std::uintmax_t total_size_{0};
+  std::ofstream writer_;
+  std::ifstream reader_;
+  std::uintmax_t read_offset_{0};
+  std::optional<Record> head_;
+  std::optional<std::uint64_t> last_seq_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // SEGMENT_LOG_H
@@ -5,45 +5,141 @@
 #ifndef SHARED_QUEUE_H
 #define SHARED_QUEUE_H
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "blocking_queue.hpp"
 
 namespace AstarteDeviceSdk {
 
+/**
+ * @brief Queue protected by a mutex, safe for any number of producers and consumers.
+ * @details When bounded, push returns false for every item that is not stored. Items discarded by
+ * the kDropOldest and kDropNewest policies, and kBlock pushes interrupted by a stop request, are
+ * counted as dropped. Items refused by the kFail policy or by a closed queue are not counted, the
+ * refusal is reported to the producer only.
+ */
 template <typename T>
-class SharedQueue {
+class SharedQueue : public BlockingQueue<T> {
  public:
-  auto pop(const std::chrono::milliseconds& timeout) -> std::optional<T> {
+  using BlockingQueue<T>::push;
+
+  /**
+   * @brief Construct a new shared queue.
+   * @param capacity The maximum number of items in the queue, zero for an unbounded queue.
+   * @param policy The policy to apply when pushing to a full queue.
+   */
+  explicit SharedQueue(std::size_t capacity = 0,
+                       AstarteOverflowPolicy policy = AstarteOverflowPolicy::kBlock)
+      : capacity_(capacity), policy_(policy) {}
+
+  auto pop(const std::chrono::milliseconds& timeout) -> std::optional<T> override {
     std::unique_lock<std::mutex> mlock(mutex_);
     if (condition_.wait_for(mlock, timeout, [this] { return !queue_.empty(); })) {
-      T res = queue_.front();
+      T res = std::move(queue_.front());
       queue_.pop();
+      not_full_.notify_one();
       return res;
     }
     return std::nullopt;
   }
-  void push(const T& item) {
+  auto pop_batch(std::vector<T>& out, std::size_t max, const std::chrono::milliseconds& timeout)
+      -> std::size_t override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    if ((max == 0) || !condition_.wait_for(mlock, timeout, [this] { return !queue_.empty(); })) {
+      return 0;
+    }
+    const std::size_t count = std::min(max, queue_.size());
+    out.reserve(out.size() + count);
+    for (std::size_t i = 0; i < count; ++i) {
+      out.push_back(std::move(queue_.front()));
+      queue_.pop();
+    }
+    // More than one slot might have been freed
+    not_full_.notify_all();
+    return count;
+  }
+  auto push(T item, const std::stop_token& token) -> bool override {
     std::unique_lock<std::mutex> mlock(mutex_);
-    queue_.push(item);
+    if (closed_) {
+      return false;
+    }
+    if (full()) {
+      switch (policy_) {
+        case AstarteOverflowPolicy::kBlock:
+          if (!not_full_.wait(mlock, token, [this] { return closed_ || !full(); })) {
+            dropped_++;
+            return false;
+          }
+          if (closed_) {
+            return false;
+          }
+          break;
+        case AstarteOverflowPolicy::kDropOldest:
+          queue_.pop();
+          dropped_++;
+          break;
+        case AstarteOverflowPolicy::kDropNewest:
+          dropped_++;
+          return false;
+        case AstarteOverflowPolicy::kFail:
+          return false;
+      }
+    }
+    queue_.push(std::move(item));
     condition_.notify_one();
+    return true;
   }
-  auto size() -> std::size_t {
+  auto size() -> std::size_t override {
     std::unique_lock<std::mutex> mlock(mutex_);
     return queue_.size();
   }
-  auto empty() -> bool {
+  auto empty() -> bool override {
     std::unique_lock<std::mutex> mlock(mutex_);
     return queue_.empty();
   }
+  auto dropped() -> std::uint64_t override {
+    std::unique_lock<std::mutex> mlock(mutex_);
+    return dropped_;
+  }
+  /**
+   * @brief Close the queue, refusing new items and releasing all blocked producers.
+   * @details Items already in the queue can still be popped.
+   */
+  void close() {
+    {
+      std::unique_lock<std::mutex> mlock(mutex_);
+      closed_ = true;
+    }
+    not_full_.notify_all();
+  }
+  /**
+   * @brief Get the policy applied when pushing to a full queue.
+   * @return The overflow policy of the queue.
+   */
+  [[nodiscard]] auto policy() const -> AstarteOverflowPolicy { return policy_; }
 
  private:
+  auto full() -> bool { return (capacity_ != 0) && (queue_.size() >= capacity_); }
+
+  std::size_t capacity_;
+  AstarteOverflowPolicy policy_;
+  std::uint64_t dropped_{0};
+  bool closed_{false};
   std::queue<T> queue_;
   std::mutex mutex_;
   std::condition_variable condition_;
+  std::condition_variable_any not_full_;
 };
 
 }  // namespace AstarteDeviceSdk
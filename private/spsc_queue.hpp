@@ -0,0 +1,207 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "blocking_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Lock-free queue for a single producer and a single consumer.
+ * @details Items are stored in a linked list of fixed size ring blocks. Pushing and popping never
+ * take a lock, the only exceptions being a consumer blocked waiting on an empty queue and a
+ * producer blocked waiting on a full queue, that are woken up through condition variables.
+ * Calling push from more than one thread, or pop and pop_batch from more than one thread, is
+ * undefined behaviour.
+ */
+template <typename T>
+class SpscQueue : public BlockingQueue<T> {
+ public:
+  using BlockingQueue<T>::push;
+
+  /**
+   * @brief Construct a new single producer single consumer queue.
+   * @param capacity The maximum number of items in the queue, zero for an unbounded queue.
+   * @param policy The policy to apply when pushing to a full queue, with the same meaning as for
+   * SharedQueue. Since the producer can not remove items from the queue, the kDropOldest policy
+   * behaves as kDropNewest.
+   */
+  explicit SpscQueue(std::size_t capacity = 0,
+                     AstarteOverflowPolicy policy = AstarteOverflowPolicy::kBlock)
+      : head_block_(new Block()), tail_block_(head_block_), capacity_(capacity), policy_(policy) {}
+  ~SpscQueue() override {
+    while (head_block_ != nullptr) {
+      Block* next = head_block_->next.load(std::memory_order_relaxed);
+      delete head_block_;
+      head_block_ = next;
+    }
+    delete spare_.load(std::memory_order_relaxed);
+  }
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue(SpscQueue&&) = delete;
+  auto operator=(const SpscQueue&) -> SpscQueue& = delete;
+  auto operator=(SpscQueue&&) -> SpscQueue& = delete;
+
+  auto push(T item, const std::stop_token& token) -> bool override {
+    if (full()) {
+      if (policy_ == AstarteOverflowPolicy::kFail) {
+        return false;
+      }
+      if ((policy_ != AstarteOverflowPolicy::kBlock) || !wait_for_space(token)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    Block* block = tail_block_;
+    if (tail_index_ == block_size) {
+      // Reuse the last block released by the consumer, if any, to avoid an allocation
+      Block* next = spare_.exchange(nullptr, std::memory_order_acq_rel);
+      if (next == nullptr) {
+        next = new Block();
+      } else {
+        next->next.store(nullptr, std::memory_order_relaxed);
+      }
+      block->next.store(next, std::memory_order_release);
+      tail_block_ = next;
+      tail_index_ = 0;
+      block = next;
+    }
+    block->slots[tail_index_].emplace(std::move(item));
+    tail_index_++;
+    // Publishes the item to the consumer
+    pushed_.fetch_add(1, std::memory_order_seq_cst);
+
+    // Only take the lock when the consumer is, or is about to be, waiting
+    if (waiters_.load(std::memory_order_seq_cst) > 0) {
+      const std::lock_guard<std::mutex> lock(wait_mutex_);
+      condition_.notify_one();
+    }
+    return true;
+  }
+  auto pop(const std::chrono::milliseconds& timeout) -> std::optional<T> override {
+    if (!wait_for_items(timeout)) {
+      return std::nullopt;
+    }
+    return try_pop();
+  }
+  auto pop_batch(std::vector<T>& out, std::size_t max, const std::chrono::milliseconds& timeout)
+      -> std::size_t override {
+    if ((max == 0) || !wait_for_items(timeout)) {
+      return 0;
+    }
+    std::size_t count = 0;
+    while (count < max) {
+      std::optional<T> item = try_pop();
+      if (!item) {
+        break;
+      }
+      out.push_back(std::move(item.value()));
+      count++;
+    }
+    return count;
+  }
+  auto size() -> std::size_t override {
+    // Loading the consumer counter first guarantees the difference is never negative
+    const std::size_t popped = popped_.load(std::memory_order_acquire);
+    return pushed_.load(std::memory_order_acquire) - popped;
+  }
+  auto empty() -> bool override { return size() == 0; }
+  auto dropped() -> std::uint64_t override { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  static constexpr std::size_t block_size = 128;
+  static constexpr std::size_t cache_line_size = 64;
+
+  struct Block {
+    std::array<std::optional<T>, block_size> slots;
+    std::atomic<Block*> next{nullptr};
+  };
+
+  auto full() -> bool {
+    return (capacity_ != 0) && ((pushed_.load(std::memory_order_relaxed) -
+                                 popped_.load(std::memory_order_seq_cst)) >= capacity_);
+  }
+  auto wait_for_space(const std::stop_token& token) -> bool {
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    producer_waiting_.store(true, std::memory_order_seq_cst);
+    const bool ready = not_full_.wait(lock, token, [this] { return !full(); });
+    producer_waiting_.store(false, std::memory_order_seq_cst);
+    return ready;
+  }
+  auto has_items() -> bool {
+    return pushed_.load(std::memory_order_seq_cst) != popped_.load(std::memory_order_relaxed);
+  }
+  auto wait_for_items(const std::chrono::milliseconds& timeout) -> bool {
+    if (has_items()) {
+      return true;
+    }
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    waiters_.fetch_add(1, std::memory_order_seq_cst);
+    const bool ready = condition_.wait_for(lock, timeout, [this] { return has_items(); });
+    waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    return ready;
+  }
+  auto try_pop() -> std::optional<T> {
+    if (popped_.load(std::memory_order_relaxed) == pushed_.load(std::memory_order_acquire)) {
+      return std::nullopt;
+    }
+    // The next block is linked before the first item in it is published
+    if (head_index_ == block_size) {
+      Block* next = head_block_->next.load(std::memory_order_acquire);
+      delete spare_.exchange(head_block_, std::memory_order_acq_rel);
+      head_block_ = next;
+      head_index_ = 0;
+    }
+    std::optional<T>& slot = head_block_->slots[head_index_];
+    std::optional<T> item(std::move(slot));
+    slot.reset();
+    head_index_++;
+    popped_.fetch_add(1, std::memory_order_seq_cst);
+
+    // Only take the lock when the producer is, or is about to be, waiting
+    if (producer_waiting_.load(std::memory_order_seq_cst)) {
+      const std::lock_guard<std::mutex> lock(wait_mutex_);
+      not_full_.notify_one();
+    }
+    return item;
+  }
+
+  // Consumer side
+  alignas(cache_line_size) Block* head_block_;
+  std::size_t head_index_{0};
+  std::atomic<std::size_t> popped_{0};
+  // Producer side
+  alignas(cache_line_size) Block* tail_block_;
+  std::size_t tail_index_{0};
+  std::atomic<std::size_t> pushed_{0};
+  // Shared between the two sides
+  alignas(cache_line_size) std::atomic<Block*> spare_{nullptr};
+  std::size_t capacity_;
+  AstarteOverflowPolicy policy_;
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<int> waiters_{0};
+  std::atomic_bool producer_waiting_{false};
+  std::mutex wait_mutex_;
+  std::condition_variable condition_;
+  std::condition_variable_any not_full_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // SPSC_QUEUE_H
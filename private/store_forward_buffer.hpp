@@ -0,0 +1,108 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef STORE_FORWARD_BUFFER_H
+#define STORE_FORWARD_BUFFER_H
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/store_forward.hpp"
+#include "interface.hpp"
+#include "segment_log.hpp"
+
+namespace AstarteDeviceSdk {
+
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
+
+/**
+ * @brief Buffer for the messages that could not be transmitted to the message hub.
+ * @details Volatile messages are kept in a bounded in-memory ring, stored messages in a segment
+ * log on disk. Messages are returned in insertion order, regardless of their retention.
+ * This class is thread safe.
+ */
+class StoreForwardBuffer {
+ public:
+  /**
+   * @brief Create a new buffer.
+   * @param config The store and forward configuration.
+   * @return The new buffer or an error if the storage could not be opened.
+   */
+  static auto create(const AstarteStoreForwardConfig& config)
+      -> astarte_tl::expected<std::unique_ptr<StoreForwardBuffer>, AstarteError>;
+
+  /**
+   * @brief Buffer a message.
+   * @param message The message to buffer.
+   * @param retention The retention of the message, should not be kDiscard.
+   * @param expiry Time after which the message is discarded, zero for no expiry.
+   * @return An error if the message could not be buffered.
+   */
+  auto push(const gRPCAstarteMessage& message, AstarteRetention retention,
+            std::chrono::seconds expiry) -> astarte_tl::expected<void, AstarteError>;
+  /** @brief A buffered message, with the sequence number identifying it in the buffer. */
+  struct Entry {
+    /** @brief Sequence number of the message, to be passed to pop. */
+    std::uint64_t seq;
+    /** @brief The buffered message. */
+    gRPCAstarteMessage message;
+  };
+
+  /**
+   * @brief Get a copy of the oldest message in the buffer, without removing it.
+   * @details Expired messages are discarded.
+   * @param timeout Will block for this timeout if the buffer is empty.
+   * @return The oldest message or std::nullopt if the buffer is empty.
+   */
+  auto front(const std::chrono::milliseconds& timeout) -> std::optional<Entry>;
+  /**
+   * @brief Remove a message previously returned by front.
+   * @details The oldest message might have changed since front was called, because of an
+   * overflow of the volatile ring or of the storage. Nothing is removed in that case.
+   * @param seq The sequence number of the message to remove.
+   */
+  void pop(std::uint64_t seq);
+  /**
+   * @brief Check if the buffer is empty.
+   * @return True if the buffer is empty, false otherwise.
+   */
+  auto empty() -> bool;
+
+ private:
+  struct VolatileEntry {
+    std::uint64_t seq;
+    std::int64_t expiry_ms;
+    gRPCAstarteMessage message;
+  };
+
+  StoreForwardBuffer(std::size_t volatile_capacity, std::optional<SegmentLog> log);
+  auto empty_locked() -> bool;
+  auto volatile_is_next() -> bool;
+
+  std::size_t volatile_capacity_;
+  std::deque<VolatileEntry> volatile_;
+  std::optional<SegmentLog> log_;
+  std::uint64_t next_seq_{0};
+  std::mutex mutex_;
+  std::condition_variable condition_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // STORE_FORWARD_BUFFER_H
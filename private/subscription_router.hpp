@@ -0,0 +1,105 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SUBSCRIPTION_ROUTER_H
+#define SUBSCRIPTION_ROUTER_H
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/message_handler.hpp"
+#include "astarte_device_sdk/msg.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Routes the received messages to the handlers subscribed to their interface and path.
+ * @details Path patterns are split in segments, a segment in the form %{name} matches any
+ * non-empty segment of the message path. The subscriptions are compiled into a trie, rebuilt on
+ * each subscription change. Routing works on an immutable snapshot of the trie, so handlers can
+ * subscribe and unsubscribe while messages are being routed.
+ */
+class SubscriptionRouter {
+ public:
+  /**
+   * @brief Add a subscription.
+   * @param interface_name The name of the interface of the messages.
+   * @param path_pattern The pattern of the paths of the messages, e.g. "/%{sensor_id}/value".
+   * @param handler The handler to invoke for the matching messages.
+   * @return The identifier of the subscription or an error if the pattern is invalid.
+   */
+  auto subscribe(std::string_view interface_name, std::string_view path_pattern,
+                 AstarteMessageHandler handler)
+      -> astarte_tl::expected<AstarteSubscriptionId, AstarteError>;
+  /**
+   * @brief Remove a subscription.
+   * @param subscription The identifier returned by subscribe.
+   * @return True if the subscription has been removed, false if it did not exist.
+   */
+  auto unsubscribe(AstarteSubscriptionId subscription) -> bool;
+  /**
+   * @brief Check if there are no subscriptions.
+   * @return True if there are no subscriptions.
+   */
+  auto empty() -> bool;
+  /**
+   * @brief Invoke the handlers of all the subscriptions matching the message.
+   * @param message The message to route.
+   * @return The number of handlers invoked.
+   */
+  auto route(const AstarteMessage& message) -> std::size_t;
+
+ private:
+  struct StringHash {
+    using is_transparent = void;
+    auto operator()(std::string_view str) const -> std::size_t {
+      return std::hash<std::string_view>{}(str);
+    }
+  };
+  template <typename T>
+  using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+  struct Node {
+    StringMap<Node> children;
+    std::unique_ptr<Node> parameter;
+    std::vector<std::shared_ptr<const AstarteMessageHandler>> handlers;
+  };
+  struct Subscription {
+    std::string interface_name;
+    std::vector<std::string> segments;
+    std::shared_ptr<const AstarteMessageHandler> handler;
+  };
+  using Trie = StringMap<Node>;
+
+  static auto split_pattern(std::string_view path_pattern)
+      -> astarte_tl::expected<std::vector<std::string>, AstarteError>;
+  static auto is_parameter(std::string_view segment) -> bool;
+  static auto match(const Node& node, std::string_view path, const AstarteMessage& message)
+      -> std::size_t;
+  // Should be called while holding the mutex
+  void rebuild();
+
+  std::mutex mutex_;
+  AstarteSubscriptionId next_id_{0};
+  std::map<AstarteSubscriptionId, Subscription> subscriptions_;
+  std::shared_ptr<const Trie> trie_{std::make_shared<const Trie>()};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // SUBSCRIPTION_ROUTER_H
@@ -4,11 +4,13 @@
 
 #include <QCoreApplication>
 #include <QDebug>
+#include <QSocketNotifier>
 #include <QThread>
 #include <QTimer>
 #include <chrono>
 #include <filesystem>
 #include <memory>
+#include <vector>
 
 #include "astarte_device_sdk/data.hpp"
 #include "astarte_device_sdk/device_grpc.hpp"
@@ -36,17 +38,24 @@ class AstarteWorker : public QObject {
 
     QTimer::singleShot(3000, this, &AstarteWorker::sendInitialData);
 
-    pollingTimer = new QTimer(this);
-    connect(pollingTimer, &QTimer::timeout, this, &AstarteWorker::pollMessages);
-    pollingTimer->start(100);
+    // The device descriptor becomes readable as soon as a message is received
+    auto handle = device->native_handle();
+    if (!handle) {
+      qCritical() << QString::fromStdString(astarte_fmt::format("{}", handle.error()));
+      return;
+    }
+    receptionNotifier = new QSocketNotifier(handle.value(), QSocketNotifier::Read, this);
+    connect(receptionNotifier, &QSocketNotifier::activated, this, &AstarteWorker::pollMessages);
   }
 
  private slots:
   void pollMessages() {
-    auto incoming = device->poll_incoming(std::chrono::milliseconds(0));
-    if (incoming.has_value()) {
-      AstarteMessage msg(incoming.value());
-      qInfo() << "Received:" << QString::fromStdString(astarte_fmt::format("{}", msg));
+    std::vector<AstarteMessage> messages;
+    while (device->poll_incoming_batch(messages, 64, std::chrono::milliseconds(0)) > 0) {
+      for (const auto& msg : messages) {
+        qInfo() << "Received:" << QString::fromStdString(astarte_fmt::format("{}", msg));
+      }
+      messages.clear();
     }
   }
 
@@ -189,7 +198,7 @@ class AstarteWorker : public QObject {
 
  private:
   std::shared_ptr<AstarteDeviceGrpc> device;
-  QTimer* pollingTimer;
+  QSocketNotifier* receptionNotifier = nullptr;
 
   void addInterfaces() {
     qInfo() << "Adding interfaces";
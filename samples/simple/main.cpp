@@ -23,32 +23,24 @@ using AstarteDeviceSdk::AstarteInvalidInputError;
 using AstarteDeviceSdk::AstarteMessage;
 using AstarteDeviceSdk::AstartePropertyIndividual;
 
-using namespace std::chrono_literals;
-
-void reception_handler(std::stop_token token, std::shared_ptr<AstarteDeviceGrpc> device) {
-  while (!token.stop_requested()) {
-    auto incoming = device->poll_incoming(100ms);
-    if (incoming.has_value()) {
-      AstarteMessage msg(incoming.value());
-      spdlog::info("Received message.");
-      spdlog::info("Interface name: {}", msg.get_interface());
-      spdlog::info("Path: {}", msg.get_path());
-      if (msg.is_datastream()) {
-        if (msg.is_individual()) {
-          spdlog::info("Type: individual datastream");
-          const auto& data(msg.into<AstarteDatastreamIndividual>());
-          spdlog::info("Value: {}", data);
-        } else {
-          spdlog::info("Type: object datastream");
-          const auto& data(msg.into<AstarteDatastreamObject>());
-          spdlog::info("Value: {}", data);
-        }
-      } else {
-        spdlog::info("Type: individual property");
-        const auto& data(msg.into<AstartePropertyIndividual>());
-        spdlog::info("Value: {}", data);
-      }
-    }
+void message_handler(const AstarteMessage& msg) {
+  spdlog::info("Received message.");
+  spdlog::info("Interface name: {}", msg.get_interface());
+  spdlog::info("Path: {}", msg.get_path());
+  if (msg.is_datastream()) {
+    if (msg.is_individual()) {
+      spdlog::info("Type: individual datastream");
+      const auto& data(msg.into<AstarteDatastreamIndividual>());
+      spdlog::info("Value: {}", data);
+    } else {
+      spdlog::info("Type: object datastream");
+      const auto& data(msg.into<AstarteDatastreamObject>());
+      spdlog::info("Value: {}", data);
+    }
+  } else {
+    spdlog::info("Type: individual property");
+    const auto& data(msg.into<AstartePropertyIndividual>());
+    spdlog::info("Value: {}", data);
   }
 }
 
@@ -92,8 +84,13 @@ int main(int argc, char** argv) {
     std::this_thread::sleep_for(std::chrono::seconds(1));
   } while (!device->is_connected());
 
-  // Start a reception thread for the Astarte device
-  auto reception_thread = std::jthread(reception_handler, device);
+  // Received messages are delivered to the handler by the device
+  res = device->set_message_handler(message_handler);
+  if (!res) {
+    spdlog::critical("Setting the message handler failed");
+    spdlog::critical(res.error());
+    return EXIT_FAILURE;
+  }
 
   {
     std::string interface_name("org.astarte-platform.cpp.examples.DeviceDatastream");
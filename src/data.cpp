@@ -7,7 +7,10 @@
 #include <chrono>
 #include <cstdint>
 #include <ctime>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -43,23 +46,30 @@ auto AstarteData::get_type() const -> AstarteType {
       return kDatetimeArray;
     }
   };
-  return std::visit(Visitor{}, data_);
+  return visit(Visitor{});
 }
 
-auto AstarteData::get_raw_data() const
-    -> const std::variant<int32_t, int64_t, double, bool, std::string, std::vector<uint8_t>,
-                          std::chrono::system_clock::time_point, std::vector<int32_t>,
-                          std::vector<int64_t>, std::vector<double>, std::vector<bool>,
-                          std::vector<std::string>, std::vector<std::vector<uint8_t>>,
-                          std::vector<std::chrono::system_clock::time_point>>& {
-  return this->data_;
+auto AstarteData::get_raw_data() const -> const VariantType& { return raw(); }
+
+auto AstarteData::take() && -> VariantType {
+  if (auto* shared = std::get_if<Shared>(&data_)) {
+    if (is_sole_owner(*shared)) {
+      return std::move(**shared);
+    }
+    return **shared;
+  }
+  return std::get<VariantType>(data_);
 }
 
 auto AstarteData::operator==(const AstarteData& other) const -> bool {
-  return this->data_ == other.get_raw_data();
-}
-auto AstarteData::operator!=(const AstarteData& other) const -> bool {
-  return this->data_ != other.get_raw_data();
+  const auto* lhs = std::get_if<Shared>(&this->data_);
+  const auto* rhs = std::get_if<Shared>(&other.data_);
+  // Copies of the same instance share their payload
+  if ((lhs != nullptr) && (rhs != nullptr) && (*lhs == *rhs)) {
+    return true;
+  }
+  return this->raw() == other.raw();
 }
+auto AstarteData::operator!=(const AstarteData& other) const -> bool { return !(*this == other); }
 
 }  // namespace AstarteDeviceSdk
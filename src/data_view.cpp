@@ -0,0 +1,79 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/data_view.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+// Copies the viewed elements into the owning vector type accepted by AstarteData.
+struct ToDataVisitor {
+  auto operator()(std::span<const std::string_view> values) -> AstarteData {
+    return AstarteData(std::vector<std::string>(values.begin(), values.end()));
+  }
+  auto operator()(std::span<const std::span<const uint8_t>> values) -> AstarteData {
+    std::vector<std::vector<uint8_t>> blobs;
+    blobs.reserve(values.size());
+    for (const auto& value : values) {
+      blobs.emplace_back(value.begin(), value.end());
+    }
+    return AstarteData(std::move(blobs));
+  }
+  template <typename T>
+  auto operator()(std::span<const T> values) -> AstarteData {
+    return AstarteData(std::vector<T>(values.begin(), values.end()));
+  }
+};
+
+}  // namespace
+
+auto AstarteDataView::get_type() const -> AstarteType {
+  struct Visitor {
+    auto operator()(std::span<const uint8_t> /*unused*/) -> AstarteType { return kBinaryBlob; }
+    auto operator()(std::span<const int32_t> /*unused*/) -> AstarteType { return kIntegerArray; }
+    auto operator()(std::span<const int64_t> /*unused*/) -> AstarteType {
+      return kLongIntegerArray;
+    }
+    auto operator()(std::span<const double> /*unused*/) -> AstarteType { return kDoubleArray; }
+    auto operator()(std::span<const bool> /*unused*/) -> AstarteType { return kBooleanArray; }
+    auto operator()(std::span<const std::string> /*unused*/) -> AstarteType {
+      return kStringArray;
+    }
+    auto operator()(std::span<const std::string_view> /*unused*/) -> AstarteType {
+      return kStringArray;
+    }
+    auto operator()(std::span<const std::vector<uint8_t>> /*unused*/) -> AstarteType {
+      return kBinaryBlobArray;
+    }
+    auto operator()(std::span<const std::span<const uint8_t>> /*unused*/) -> AstarteType {
+      return kBinaryBlobArray;
+    }
+    auto operator()(std::span<const std::chrono::system_clock::time_point> /*unused*/)
+        -> AstarteType {
+      return kDatetimeArray;
+    }
+  };
+  return std::visit(Visitor{}, data_);
+}
+
+auto AstarteDataView::get_raw_data() const -> const VariantType& { return this->data_; }
+
+auto AstarteDataView::to_data() const -> AstarteData {
+  return std::visit(ToDataVisitor{}, data_);
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,137 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/device.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/series.hpp"
+
+namespace AstarteDeviceSdk {
+
+// The default implementations rely only on the functions available since the first release, so
+// that devices implemented outside of the SDK keep working without overriding the newer ones.
+
+auto AstarteDevice::send_individual(std::string_view interface_name, std::string_view path,
+                                    AstarteData&& data,
+                                    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  const AstarteData& value = data;
+  return send_individual(interface_name, path, value, timestamp);
+}
+
+auto AstarteDevice::send_individual(std::string_view interface_name, std::string_view path,
+                                    const AstarteDataView& data,
+                                    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  return send_individual(interface_name, path, data.to_data(), timestamp);
+}
+
+auto AstarteDevice::send_object(std::string_view interface_name, std::string_view path,
+                                AstarteDatastreamObject&& object,
+                                const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  const AstarteDatastreamObject& value = object;
+  return send_object(interface_name, path, value, timestamp);
+}
+
+auto AstarteDevice::set_property(std::string_view interface_name, std::string_view path,
+                                 AstarteData&& data) -> astarte_tl::expected<void, AstarteError> {
+  const AstarteData& value = data;
+  return set_property(interface_name, path, value);
+}
+
+auto AstarteDevice::send_batch(std::span<const AstarteOutgoingMessage> messages)
+    -> std::vector<astarte_tl::expected<void, AstarteError>> {
+  std::vector<astarte_tl::expected<void, AstarteError>> results;
+  results.reserve(messages.size());
+  for (const AstarteOutgoingMessage& message : messages) {
+    const std::string_view interface_name = message.get_interface();
+    const std::string_view path = message.get_path();
+    const auto& timestamp = message.get_timestamp();
+    const std::chrono::system_clock::time_point* timestamp_ptr =
+        timestamp ? &timestamp.value() : nullptr;
+    results.push_back(std::visit(
+        [&](const auto& data) -> astarte_tl::expected<void, AstarteError> {
+          using T = std::decay_t<decltype(data)>;
+          if constexpr (std::is_same_v<T, AstarteDatastreamIndividual>) {
+            return send_individual(interface_name, path, data.get_value(), timestamp_ptr);
+          } else if constexpr (std::is_same_v<T, AstarteDatastreamObject>) {
+            return send_object(interface_name, path, data, timestamp_ptr);
+          } else {
+            const std::optional<AstarteData>& value = data.get_value();
+            return value ? set_property(interface_name, path, value.value())
+                         : unset_property(interface_name, path);
+          }
+        },
+        message.get_raw_data()));
+  }
+  return results;
+}
+
+auto AstarteDevice::send_series(std::string_view interface_name, std::string_view path,
+                                const AstarteDatastreamSeries& series)
+    -> std::vector<astarte_tl::expected<void, AstarteError>> {
+  std::vector<astarte_tl::expected<void, AstarteError>> results(series.size());
+  const auto& timestamps = series.get_timestamps();
+  if (timestamps.size() != series.size()) {
+    for (auto& result : results) {
+      result = astarte_tl::unexpected(
+          AstarteInvalidInputError{"Series with a different number of values and timestamps."});
+    }
+    return results;
+  }
+  bool failed = false;
+  for (std::size_t i = 0; i < series.size(); ++i) {
+    if (failed) {
+      results[i] = astarte_tl::unexpected(
+          AstarteOperationRefusedError{"Series transmission aborted after a failed sample."});
+      continue;
+    }
+    results[i] = send_individual(interface_name, path, series.value_at(i), &timestamps[i]);
+    failed = !results[i];
+  }
+  return results;
+}
+
+auto AstarteDevice::poll_incoming_batch(std::vector<AstarteMessage>& out, std::size_t max,
+                                        std::chrono::milliseconds timeout) -> std::size_t {
+  std::size_t count = 0;
+  // Only the first message is waited for, the others must have already been received
+  std::chrono::milliseconds wait = timeout;
+  while (count < max) {
+    std::optional<AstarteMessage> message = poll_incoming(wait);
+    if (!message) {
+      break;
+    }
+    out.push_back(std::move(message.value()));
+    ++count;
+    wait = std::chrono::milliseconds(0);
+  }
+  return count;
+}
+
+}  // namespace AstarteDeviceSdk
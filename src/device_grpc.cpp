@@ -5,12 +5,17 @@
 #include "astarte_device_sdk/device_grpc.hpp"
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <future>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #if defined(ASTARTE_USE_TL_EXPECTED)
 #include "tl/expected.hpp"
@@ -18,14 +23,25 @@
 #include <expected>
 #endif
 
+#include "astarte_device_sdk/awaitable.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/message_consumer.hpp"
+#include "astarte_device_sdk/message_handler.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/reception_queue.hpp"
+#include "astarte_device_sdk/series.hpp"
+#include "astarte_device_sdk/store_forward.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
 #include "device_grpc_impl.hpp"
+#include "endpoint_handle_impl.hpp"
+#include "message_consumer_impl.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -61,6 +77,27 @@ auto AstarteDeviceGrpc::disconnect() -> astarte_tl::expected<void, AstarteError>
   return astarte_device_impl_->disconnect();
 }
 
+auto AstarteDeviceGrpc::set_outbound_queue(std::size_t capacity, AstarteOverflowPolicy policy)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->set_outbound_queue(capacity, policy);
+}
+
+auto AstarteDeviceGrpc::get_failed_messages() -> std::uint64_t {
+  return astarte_device_impl_->get_failed_messages();
+}
+
+auto AstarteDeviceGrpc::set_store_and_forward(const AstarteStoreForwardConfig& config)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->set_store_and_forward(config);
+}
+
+auto AstarteDeviceGrpc::prepare(std::string_view interface_name, std::string_view path)
+    -> astarte_tl::expected<AstarteEndpointHandle, AstarteError> {
+  return AstarteEndpointHandle::AstarteEndpointHandleImpl::create(astarte_device_impl_,
+                                                                  interface_name, path)
+      .transform([](auto&& impl) { return AstarteEndpointHandle(std::move(impl)); });
+}
+
 auto AstarteDeviceGrpc::send_individual(std::string_view interface_name, std::string_view path,
                                         const AstarteData& data,
                                         const std::chrono::system_clock::time_point* timestamp)
@@ -68,6 +105,20 @@ auto AstarteDeviceGrpc::send_individual(std::string_view interface_name, std::st
   return astarte_device_impl_->send_individual(interface_name, path, data, timestamp);
 }
 
+auto AstarteDeviceGrpc::send_individual(std::string_view interface_name, std::string_view path,
+                                        AstarteData&& data,
+                                        const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->send_individual(interface_name, path, std::move(data), timestamp);
+}
+
+auto AstarteDeviceGrpc::send_individual(std::string_view interface_name, std::string_view path,
+                                        const AstarteDataView& data,
+                                        const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->send_individual(interface_name, path, data, timestamp);
+}
+
 auto AstarteDeviceGrpc::send_object(std::string_view interface_name, std::string_view path,
                                     const AstarteDatastreamObject& object,
                                     const std::chrono::system_clock::time_point* timestamp)
@@ -75,22 +126,154 @@ auto AstarteDeviceGrpc::send_object(std::string_view interface_name, std::string
   return astarte_device_impl_->send_object(interface_name, path, object, timestamp);
 }
 
+auto AstarteDeviceGrpc::send_object(std::string_view interface_name, std::string_view path,
+                                    AstarteDatastreamObject&& object,
+                                    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->send_object(interface_name, path, std::move(object), timestamp);
+}
+
 auto AstarteDeviceGrpc::set_property(std::string_view interface_name, std::string_view path,
                                      const AstarteData& data)
     -> astarte_tl::expected<void, AstarteError> {
   return astarte_device_impl_->set_property(interface_name, path, data);
 }
 
+auto AstarteDeviceGrpc::set_property(std::string_view interface_name, std::string_view path,
+                                     AstarteData&& data)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->set_property(interface_name, path, std::move(data));
+}
+
 auto AstarteDeviceGrpc::unset_property(std::string_view interface_name, std::string_view path)
     -> astarte_tl::expected<void, AstarteError> {
   return astarte_device_impl_->unset_property(interface_name, path);
 }
 
+auto AstarteDeviceGrpc::send_batch(std::span<const AstarteOutgoingMessage> messages)
+    -> std::vector<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->send_batch(messages);
+}
+
+auto AstarteDeviceGrpc::send_series(std::string_view interface_name, std::string_view path,
+                                    const AstarteDatastreamSeries& series)
+    -> std::vector<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->send_series(interface_name, path, series);
+}
+
+auto AstarteDeviceGrpc::send_individual_async(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->send_individual_async(interface_name, path, data, timestamp);
+}
+
+auto AstarteDeviceGrpc::send_object_async(std::string_view interface_name, std::string_view path,
+                                          const AstarteDatastreamObject& object,
+                                          const std::chrono::system_clock::time_point* timestamp)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->send_object_async(interface_name, path, object, timestamp);
+}
+
+auto AstarteDeviceGrpc::set_property_async(std::string_view interface_name, std::string_view path,
+                                           const AstarteData& data)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->set_property_async(interface_name, path, data);
+}
+
+auto AstarteDeviceGrpc::unset_property_async(std::string_view interface_name,
+                                             std::string_view path)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->unset_property_async(interface_name, path);
+}
+
+auto AstarteDeviceGrpc::send_individual_async(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp, const AstarteUseAwaitable& token)
+    -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->send_individual_async(interface_name, path, data, timestamp, token);
+}
+
+auto AstarteDeviceGrpc::send_object_async(std::string_view interface_name, std::string_view path,
+                                          const AstarteDatastreamObject& object,
+                                          const std::chrono::system_clock::time_point* timestamp,
+                                          const AstarteUseAwaitable& token)
+    -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->send_object_async(interface_name, path, object, timestamp, token);
+}
+
+auto AstarteDeviceGrpc::set_property_async(std::string_view interface_name, std::string_view path,
+                                           const AstarteData& data,
+                                           const AstarteUseAwaitable& token)
+    -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->set_property_async(interface_name, path, data, token);
+}
+
+auto AstarteDeviceGrpc::unset_property_async(std::string_view interface_name,
+                                             std::string_view path,
+                                             const AstarteUseAwaitable& token)
+    -> AstarteAwaitable<astarte_tl::expected<void, AstarteError>> {
+  return astarte_device_impl_->unset_property_async(interface_name, path, token);
+}
+
+auto AstarteDeviceGrpc::next_message(const AstarteUseAwaitable& token)
+    -> AstarteAwaitable<astarte_tl::expected<AstarteMessage, AstarteError>> {
+  return astarte_device_impl_->next_message(token);
+}
+
 auto AstarteDeviceGrpc::poll_incoming(const std::chrono::milliseconds& timeout)
     -> std::optional<AstarteMessage> {
   return astarte_device_impl_->poll_incoming(timeout);
 }
 
+auto AstarteDeviceGrpc::poll_incoming_batch(std::vector<AstarteMessage>& out, std::size_t max,
+                                            std::chrono::milliseconds timeout) -> std::size_t {
+  return astarte_device_impl_->poll_incoming_batch(out, max, timeout);
+}
+
+auto AstarteDeviceGrpc::native_handle() -> astarte_tl::expected<int, AstarteError> {
+  return astarte_device_impl_->native_handle();
+}
+
+auto AstarteDeviceGrpc::set_message_handler(AstarteMessageHandler handler, std::size_t workers)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->set_message_handler(std::move(handler), workers);
+}
+
+auto AstarteDeviceGrpc::subscribe(std::string_view interface_name, std::string_view path_pattern,
+                                  AstarteMessageHandler handler)
+    -> astarte_tl::expected<AstarteSubscriptionId, AstarteError> {
+  return astarte_device_impl_->subscribe(interface_name, path_pattern, std::move(handler));
+}
+
+auto AstarteDeviceGrpc::unsubscribe(AstarteSubscriptionId subscription)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->unsubscribe(subscription);
+}
+
+auto AstarteDeviceGrpc::set_reception_queue(AstarteReceptionQueue type, std::size_t capacity,
+                                            AstarteOverflowPolicy policy)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->set_reception_queue(type, capacity, policy);
+}
+
+auto AstarteDeviceGrpc::get_dropped_messages() -> std::uint64_t {
+  return astarte_device_impl_->get_dropped_messages();
+}
+
+auto AstarteDeviceGrpc::set_decode_workers(std::size_t workers)
+    -> astarte_tl::expected<void, AstarteError> {
+  return astarte_device_impl_->set_decode_workers(workers);
+}
+
+auto AstarteDeviceGrpc::add_message_consumer()
+    -> astarte_tl::expected<AstarteMessageConsumer, AstarteError> {
+  return astarte_device_impl_->add_message_consumer().transform([](auto&& queue) {
+    return AstarteMessageConsumer(
+        std::make_shared<AstarteMessageConsumer::AstarteMessageConsumerImpl>(std::move(queue)));
+  });
+}
+
 auto AstarteDeviceGrpc::get_all_properties(const std::optional<AstarteOwnership>& ownership)
     -> astarte_tl::expected<std::list<AstarteStoredProperty>, AstarteError> {
   return astarte_device_impl_->get_all_properties(ownership);
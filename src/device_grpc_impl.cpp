@@ -12,6 +12,7 @@
 #include <astarteplatform/msghub/node.pb.h>
 #include <astarteplatform/msghub/property.pb.h>
 #include <google/protobuf/empty.pb.h>
+#include <google/protobuf/timestamp.pb.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/security/credentials.h>
@@ -20,22 +21,33 @@
 #include <grpcpp/support/status.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <iterator>
+#include <latch>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <regex>
+#include <semaphore>
+#include <shared_mutex>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #if defined(ASTARTE_USE_TL_EXPECTED)
@@ -44,18 +56,39 @@
 #include <expected>
 #endif
 
+#include "astarte_device_sdk/awaitable.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/device_grpc.hpp"
 #include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/message_handler.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/reception_queue.hpp"
+#include "astarte_device_sdk/store_forward.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
+#include "astarte_device_sdk/type.hpp"
+#include "blocking_queue.hpp"
+#include "conflating_queue.hpp"
+#include "event_notifier.hpp"
 #include "exponential_backoff.hpp"
+#include "grpc_arena.hpp"
+#include "grpc_async.hpp"
 #include "grpc_converter.hpp"
 #include "grpc_interceptors.hpp"
+#include "interface.hpp"
+#include "message_dispatcher.hpp"
+#include "multicast_queue.hpp"
+#include "ordered_worker_pool.hpp"
 #include "shared_queue.hpp"
+#include "spsc_queue.hpp"
+#include "store_forward_buffer.hpp"
+#include "subscription_router.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -82,6 +115,65 @@ using gRPCPropertyIdentifier = astarteplatform::msghub::PropertyIdentifier;
 using gRPCInterfacesJson = astarteplatform::msghub::InterfacesJson;
 using gRPCInterfacesName = astarteplatform::msghub::InterfacesName;
 
+namespace {
+
+// Astarte type of the gRPC data, nullopt if no data is set
+auto grpc_data_type(const gRPCAstarteData& data) -> std::optional<AstarteType> {
+  switch (data.astarte_data_case()) {
+    case gRPCAstarteData::kDouble:
+      return AstarteType::kDouble;
+    case gRPCAstarteData::kInteger:
+      return AstarteType::kInteger;
+    case gRPCAstarteData::kBoolean:
+      return AstarteType::kBoolean;
+    case gRPCAstarteData::kLongInteger:
+      return AstarteType::kLongInteger;
+    case gRPCAstarteData::kString:
+      return AstarteType::kString;
+    case gRPCAstarteData::kBinaryBlob:
+      return AstarteType::kBinaryBlob;
+    case gRPCAstarteData::kDateTime:
+      return AstarteType::kDatetime;
+    case gRPCAstarteData::kDoubleArray:
+      return AstarteType::kDoubleArray;
+    case gRPCAstarteData::kIntegerArray:
+      return AstarteType::kIntegerArray;
+    case gRPCAstarteData::kBooleanArray:
+      return AstarteType::kBooleanArray;
+    case gRPCAstarteData::kLongIntegerArray:
+      return AstarteType::kLongIntegerArray;
+    case gRPCAstarteData::kStringArray:
+      return AstarteType::kStringArray;
+    case gRPCAstarteData::kBinaryBlobArray:
+      return AstarteType::kBinaryBlobArray;
+    case gRPCAstarteData::kDateTimeArray:
+      return AstarteType::kDatetimeArray;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Integers are accepted by long integer mappings, as Astarte widens them on reception. Typed
+// endpoints and series follow the same rule.
+auto data_matches_mapping(const gRPCAstarteData& data, const AstarteMapping& mapping) -> bool {
+  const std::optional<AstarteType> type = grpc_data_type(data);
+  if (!type) {
+    return false;
+  }
+  return (type.value() == mapping.type) ||
+         ((type.value() == AstarteType::kInteger) &&
+          (mapping.type == AstarteType::kLongInteger)) ||
+         ((type.value() == AstarteType::kIntegerArray) &&
+          (mapping.type == AstarteType::kLongIntegerArray));
+}
+
+auto type_mismatch(const gRPCAstarteMessage& message, std::string_view path) -> AstarteError {
+  return AstarteInvalidInputError{"Data type not matching the mapping of " +
+                                  message.interface_name() + ": " + std::string(path)};
+}
+
+}  // namespace
+
 AstarteDeviceGrpc::AstarteDeviceGrpcImpl::AstarteDeviceGrpcImpl(std::string server_addr,
                                                                 std::string node_uuid)
     : server_addr_(std::move(server_addr)),
@@ -89,7 +181,28 @@ AstarteDeviceGrpc::AstarteDeviceGrpcImpl::AstarteDeviceGrpcImpl(std::string serv
       connected_(std::atomic_bool(false)),
       grpc_stream_error_(std::atomic_bool(false)) {}
 
-AstarteDeviceGrpc::AstarteDeviceGrpcImpl::~AstarteDeviceGrpcImpl() { ssource_.request_stop(); }
+AstarteDeviceGrpc::AstarteDeviceGrpcImpl::~AstarteDeviceGrpcImpl() {
+  // The stop cancels the event stream, the connection thread is joined before any of the members
+  // used by the reader and replay threads is destroyed
+  ssource_.request_stop();
+  connection_thread_.reset();
+  stop_outbound_queue();
+  // Completing calls might store their message, drain them while the buffer still exists
+  cq_thread_.reset();
+  dispatcher_.reset();
+  retired_dispatchers_.clear();
+
+  std::deque<std::shared_ptr<MessageAwaitable::State>> waiters;
+  {
+    const std::lock_guard<std::mutex> lock(rcv_waiters_mutex_);
+    waiters.swap(rcv_waiters_);
+    rcv_waiters_count_.store(0, std::memory_order_seq_cst);
+  }
+  const std::string_view msg("The device has been destroyed while waiting for a message.");
+  for (auto& waiter : waiters) {
+    waiter->complete(astarte_tl::unexpected(AstarteOperationRefusedError{msg}));
+  }
+}
 
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::add_interface_from_file(
     const std::filesystem::path& json_file) -> astarte_tl::expected<void, AstarteError> {
@@ -117,13 +230,20 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::add_interface_from_str(std::strin
     -> astarte_tl::expected<void, AstarteError> {
   spdlog::debug("Adding interface from string");
 
+  // Interfaces the SDK does not understand are still registered, as the message hub has the final
+  // word on their validity. Their messages skip the local validation.
+  auto interface = AstarteInterface::create(json);
+  if (!interface) {
+    spdlog::warn("Interface not validated locally: {}", interface.error());
+  }
+
   // If the device is connected, notify the message hub
   if (is_connected()) {
     gRPCInterfacesJson grpc_interfaces_json;
     grpc_interfaces_json.add_interfaces_json(json);
     ClientContext context;
     google::protobuf::Empty response;
-    const Status status = stub_->AddInterfaces(&context, grpc_interfaces_json, &response);
+    const Status status = stub()->AddInterfaces(&context, grpc_interfaces_json, &response);
     if (!status.ok()) {
       spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
       return astarte_tl::unexpected(AstarteGrpcLibError{
@@ -132,6 +252,18 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::add_interface_from_str(std::strin
   }
 
   interfaces_bins_.emplace_back(json);
+  {
+    const std::unique_lock<std::shared_mutex> lock(interfaces_mutex_);
+    if (interface) {
+      const std::string name = interface->name();
+      unvalidated_interfaces_.erase(name);
+      interfaces_.insert_or_assign(name, std::move(interface.value()));
+    } else if (auto name = AstarteInterface::parse_name(json)) {
+      interfaces_.erase(name.value());
+      unvalidated_interfaces_.insert(std::move(name.value()));
+    }
+    interfaces_generation_.fetch_add(1, std::memory_order_release);
+  }
   spdlog::trace("Added interface: \n{}", json);
   return {};
 }
@@ -154,7 +286,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::remove_interface(const std::strin
         grpc_interface_names.add_names(interface_name);
         ClientContext context;
         google::protobuf::Empty response;
-        const Status status = stub_->RemoveInterfaces(&context, grpc_interface_names, &response);
+        const Status status = stub()->RemoveInterfaces(&context, grpc_interface_names, &response);
         if (!status.ok()) {
           spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
           return astarte_tl::unexpected(AstarteGrpcLibError{
@@ -162,6 +294,10 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::remove_interface(const std::strin
         }
       }
       interfaces_bins_.erase(i);
+      const std::unique_lock<std::shared_mutex> lock(interfaces_mutex_);
+      interfaces_.erase(interface_name);
+      unvalidated_interfaces_.erase(interface_name);
+      interfaces_generation_.fetch_add(1, std::memory_order_release);
       break;
     }
   }
@@ -171,6 +307,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::remove_interface(const std::strin
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::connect()
     -> astarte_tl::expected<void, AstarteError> {
   spdlog::info("Connection requested.");
+  start_reception();
   if (connection_thread_) {
     spdlog::warn("Connection process is already running.");
     return astarte_tl::unexpected(
@@ -209,7 +346,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::disconnect()
   if (connected_.load() || grpc_stream_error_.load()) {
     ClientContext context;
     google::protobuf::Empty response;
-    const Status status = stub_->Detach(&context, google::protobuf::Empty(), &response);
+    const Status status = stub()->Detach(&context, google::protobuf::Empty(), &response);
     if (!status.ok()) {
       spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
       res = astarte_tl::unexpected(AstarteGrpcLibError{
@@ -224,66 +361,113 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::disconnect()
   return res;
 }
 
-auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_individual(
-    std::string_view interface_name, std::string_view path, const AstarteData& data,
-    const std::chrono::system_clock::time_point* timestamp)
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_outbound_queue(std::size_t capacity,
+                                                                  AstarteOverflowPolicy policy)
     -> astarte_tl::expected<void, AstarteError> {
-  spdlog::debug("Sending individual: {} {}", interface_name, path);
-  if (!connected_.load()) {
-    const std::string_view msg("Device disconnected, operation aborted.");
+  spdlog::debug("Setting outbound queue, capacity: {}, policy: {}", capacity,
+                overflow_policy_as_str(policy));
+  if (connection_thread_) {
+    const std::string_view msg("The outbound queue can only be set while disconnected.");
     spdlog::warn(msg);
     return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
   }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
+  if (capacity == 0) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"The outbound queue capacity should be greater than zero."});
+  }
 
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstarteDatastreamIndividual> grpc_datastream_individual =
-      converter(data, timestamp);
-  message.set_allocated_datastream_individual(grpc_datastream_individual.release());
+  // Stop the sender of the previous queue, if any, before replacing it
+  stop_outbound_queue();
+  outbound_queue_ = std::make_unique<SharedQueue<gRPCAstarteMessage>>(capacity, policy);
+  sender_thread_.emplace([this](const std::stop_token& token) { this->sender_loop(token); });
+  return {};
+}
 
-  ClientContext context;
-  google::protobuf::Empty response;
-  spdlog::trace("Sending data: {} {}", interface_name, path);
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    return astarte_tl::unexpected(AstarteGrpcLibError{
-        static_cast<std::uint64_t>(status.error_code()), status.error_message()});
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_failed_messages() -> std::uint64_t {
+  return failed_messages_.load(std::memory_order_relaxed);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_interfaces_generation() const -> std::uint64_t {
+  return interfaces_generation_.load(std::memory_order_acquire);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::find_interface(std::string_view interface_name)
+    -> std::optional<AstarteInterface> {
+  const std::shared_lock<std::shared_mutex> lock(interfaces_mutex_);
+  auto interface = interfaces_.find(std::string(interface_name));
+  if (interface == interfaces_.end()) {
+    return std::nullopt;
+  }
+  return interface->second;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_store_and_forward(
+    const AstarteStoreForwardConfig& config) -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Setting store and forward buffer");
+  if (connection_thread_) {
+    const std::string_view msg("The store and forward buffer can only be set while disconnected.");
+    spdlog::warn(msg);
+    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+  }
+  if (config.replay_rate == 0) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"The replay rate should be greater than zero."});
+  }
+
+  auto buffer = StoreForwardBuffer::create(config);
+  if (!buffer) {
+    return astarte_tl::unexpected(buffer.error());
   }
+  store_forward_ = std::move(buffer.value());
+  replay_rate_ = config.replay_rate;
   return {};
 }
 
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_individual(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending individual: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message(*make_individual_message(arena.get(), interface_name, path, data, timestamp));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_individual(
+    std::string_view interface_name, std::string_view path, AstarteData&& data,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending individual: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message(
+      *make_individual_message(arena.get(), interface_name, path, std::move(data), timestamp));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_individual(
+    std::string_view interface_name, std::string_view path, const AstarteDataView& data,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending individual view: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message(*make_individual_message(arena.get(), interface_name, path, data, timestamp));
+}
+
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_object(
     std::string_view interface_name, std::string_view path, const AstarteDatastreamObject& object,
     const std::chrono::system_clock::time_point* timestamp)
     -> astarte_tl::expected<void, AstarteError> {
   spdlog::debug("Sending object: {} {}", interface_name, path);
-  if (!connected_.load()) {
-    const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
-    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
-  }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
-
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstarteDatastreamObject> grpc_datastream_object =
-      converter(object, timestamp);
-  message.set_allocated_datastream_object(grpc_datastream_object.release());
+  const GrpcArenaLease arena;
+  return send_message(*make_object_message(arena.get(), interface_name, path, object, timestamp));
+}
 
-  ClientContext context;
-  google::protobuf::Empty response;
-  spdlog::trace("Sending data: {} {}", interface_name, path);
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    return astarte_tl::unexpected(AstarteGrpcLibError{
-        static_cast<std::uint64_t>(status.error_code()), status.error_message()});
-  }
-  return {};
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_object(
+    std::string_view interface_name, std::string_view path, AstarteDatastreamObject&& object,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending object: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message(
+      *make_object_message(arena.get(), interface_name, path, std::move(object), timestamp));
 }
 
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_property(std::string_view interface_name,
@@ -291,64 +475,556 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_property(std::string_view int
                                                             const AstarteData& data)
     -> astarte_tl::expected<void, AstarteError> {
   spdlog::debug("Setting property: {} {}", interface_name, path);
-  if (!connected_.load()) {
-    const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
-    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+  const GrpcArenaLease arena;
+  return send_message(*make_property_message(arena.get(), interface_name, path, data));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_property(std::string_view interface_name,
+                                                            std::string_view path,
+                                                            AstarteData&& data)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Setting property: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message(*make_property_message(arena.get(), interface_name, path, std::move(data)));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::unset_property(std::string_view interface_name,
+                                                              std::string_view path)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Unsetting property: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message(*make_property_message(arena.get(), interface_name, path, std::nullopt));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_batch(
+    std::span<const AstarteOutgoingMessage> messages)
+    -> std::vector<astarte_tl::expected<void, AstarteError>> {
+  spdlog::debug("Sending batch of {} messages", messages.size());
+  std::vector<astarte_tl::expected<void, AstarteError>> results(messages.size());
+  if (messages.empty()) {
+    return results;
+  }
+  if (on_completion_queue_thread()) {
+    spdlog::warn("Batch sent from the completion queue thread, it would wait for itself.");
+    results.assign(messages.size(),
+                   astarte_tl::unexpected(AstarteOperationRefusedError{
+                       "Blocking send from the completion queue thread, operation aborted."}));
+    return results;
+  }
+
+  std::latch pending(static_cast<std::ptrdiff_t>(messages.size()));
+  // Bound the number of in flight RPCs to avoid flooding the message hub
+  std::counting_semaphore<batch_max_in_flight> window(batch_max_in_flight);
+  // The same arena message is reused for the whole batch, each RPC serializes it when started
+  const GrpcArenaLease arena;
+  gRPCAstarteMessage& message = *arena->create<gRPCAstarteMessage>();
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    fill_message(messages[i], &message);
+    if (auto valid = validate_message(message); !valid) {
+      results[i] = std::move(valid);
+      pending.count_down();
+      continue;
+    }
+    if (auto buffered = buffer_message(message)) {
+      results[i] = std::move(buffered.value());
+      pending.count_down();
+      continue;
+    }
+    if (!connected_.load()) {
+      results[i] = astarte_tl::unexpected(
+          AstarteOperationRefusedError{"Device disconnected, operation aborted."});
+      pending.count_down();
+      continue;
+    }
+    window.acquire();
+    start_send_call(
+        message,
+        [&results, &pending, &window, i](astarte_tl::expected<void, AstarteError> res) {
+          results[i] = std::move(res);
+          window.release();
+          pending.count_down();
+        });
+  }
+  pending.wait();
+  return results;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_series(std::string_view interface_name,
+                                                           std::string_view path,
+                                                           const AstarteDatastreamSeries& series)
+    -> std::vector<astarte_tl::expected<void, AstarteError>> {
+  spdlog::debug("Sending series of {} samples: {} {}", series.size(), interface_name, path);
+  std::vector<astarte_tl::expected<void, AstarteError>> results(series.size());
+  auto refuse_all = [&results](const AstarteError& error) {
+    std::fill(results.begin(), results.end(), astarte_tl::unexpected(error));
+  };
+  if (series.get_timestamps().size() != series.size()) {
+    refuse_all(
+        AstarteInvalidInputError{"Series with a different number of values and timestamps."});
+    return results;
+  }
+  if (series.empty()) {
+    return results;
+  }
+  if (on_completion_queue_thread()) {
+    spdlog::warn("Series sent from the completion queue thread, it would wait for itself.");
+    refuse_all(AstarteOperationRefusedError{
+        "Blocking send from the completion queue thread, operation aborted."});
+    return results;
   }
-  gRPCAstarteMessage message;
+
+  // The same arena message is reused for all the samples, only its data and timestamp change
+  const GrpcArenaLease arena;
+  gRPCAstarteMessage& message = *arena->create<gRPCAstarteMessage>();
   message.set_interface_name(interface_name);
   message.set_path(path);
+  GrpcConverterTo::fill(series, 0, message.mutable_datastream_individual());
+  // All the samples share interface, path and type, the first one validates the whole series
+  if (auto valid = validate_message(message); !valid) {
+    refuse_all(valid.error());
+    return results;
+  }
+  std::optional<AstarteMapping> mapping;
+  {
+    const std::shared_lock<std::shared_mutex> lock(interfaces_mutex_);
+    auto interface = interfaces_.find(message.interface_name());
+    if (interface != interfaces_.end()) {
+      if (const AstarteMapping* found = interface->second.find_mapping(message.path())) {
+        mapping = *found;
+      }
+    }
+  }
+  const AstarteMapping* mapping_ptr = mapping ? &mapping.value() : nullptr;
+
+  // Each callback writes only the result of its own sample
+  std::atomic<bool> failed{false};
+  std::size_t submitted = 0;
+  // Bound the number of in flight RPCs to avoid flooding the message hub
+  std::counting_semaphore<batch_max_in_flight> window(batch_max_in_flight);
+  std::latch pending(static_cast<std::ptrdiff_t>(series.size()));
+  for (; submitted < series.size() && !failed.load(); ++submitted) {
+    if (submitted != 0) {
+      GrpcConverterTo::fill(series, submitted, message.mutable_datastream_individual());
+    }
+    if (auto buffered = buffer_message(message, mapping_ptr)) {
+      if (!buffered.value()) {
+        failed.store(true);
+      }
+      results[submitted] = std::move(buffered.value());
+      pending.count_down();
+      continue;
+    }
+    if (!connected_.load()) {
+      results[submitted] = astarte_tl::unexpected(
+          AstarteOperationRefusedError{"Device disconnected, operation aborted."});
+      failed.store(true);
+      pending.count_down();
+      continue;
+    }
+    window.acquire();
+    start_send_call(message, [&results, &failed, &pending, &window,
+                              index = submitted](astarte_tl::expected<void, AstarteError> res) {
+      if (!res) {
+        failed.store(true);
+      }
+      results[index] = std::move(res);
+      window.release();
+      pending.count_down();
+    });
+  }
+  // Samples not submitted after a failure never complete
+  for (std::size_t i = submitted; i < series.size(); ++i) {
+    results[i] = astarte_tl::unexpected(
+        AstarteOperationRefusedError{"Series transmission aborted after a failed sample."});
+  }
+  pending.count_down(static_cast<std::ptrdiff_t>(series.size() - submitted));
+  pending.wait();
+  return results;
+}
 
-  const std::optional<AstarteData>& opt_data = data;
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstartePropertyIndividual> grpc_property_individual = converter(opt_data);
-  message.set_allocated_property_individual(grpc_property_individual.release());
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_individual_async(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  spdlog::debug("Sending individual asynchronously: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_async(
+      *make_individual_message(arena.get(), interface_name, path, data, timestamp));
+}
 
-  ClientContext context;
-  google::protobuf::Empty response;
-  spdlog::trace("Sending data: {} {}", interface_name, path);
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    return astarte_tl::unexpected(AstarteGrpcLibError{
-        static_cast<std::uint64_t>(status.error_code()), status.error_message()});
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_object_async(
+    std::string_view interface_name, std::string_view path, const AstarteDatastreamObject& object,
+    const std::chrono::system_clock::time_point* timestamp)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  spdlog::debug("Sending object asynchronously: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_async(
+      *make_object_message(arena.get(), interface_name, path, object, timestamp));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_property_async(std::string_view interface_name,
+                                                                  std::string_view path,
+                                                                  const AstarteData& data)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  spdlog::debug("Setting property asynchronously: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_async(*make_property_message(arena.get(), interface_name, path, data));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::unset_property_async(
+    std::string_view interface_name, std::string_view path)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  spdlog::debug("Unsetting property asynchronously: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_async(
+      *make_property_message(arena.get(), interface_name, path, std::nullopt));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_individual_async(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp, const AstarteUseAwaitable& token)
+    -> SendAwaitable {
+  spdlog::debug("Sending individual awaitable: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_awaitable(
+      *make_individual_message(arena.get(), interface_name, path, data, timestamp), token);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_object_async(
+    std::string_view interface_name, std::string_view path, const AstarteDatastreamObject& object,
+    const std::chrono::system_clock::time_point* timestamp, const AstarteUseAwaitable& token)
+    -> SendAwaitable {
+  spdlog::debug("Sending object awaitable: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_awaitable(
+      *make_object_message(arena.get(), interface_name, path, object, timestamp), token);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_property_async(std::string_view interface_name,
+                                                                  std::string_view path,
+                                                                  const AstarteData& data,
+                                                                  const AstarteUseAwaitable& token)
+    -> SendAwaitable {
+  spdlog::debug("Setting property awaitable: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_awaitable(*make_property_message(arena.get(), interface_name, path, data),
+                                token);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::unset_property_async(
+    std::string_view interface_name, std::string_view path, const AstarteUseAwaitable& token)
+    -> SendAwaitable {
+  spdlog::debug("Unsetting property awaitable: {} {}", interface_name, path);
+  const GrpcArenaLease arena;
+  return send_message_awaitable(
+      *make_property_message(arena.get(), interface_name, path, std::nullopt), token);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::next_message(const AstarteUseAwaitable& token)
+    -> MessageAwaitable {
+  auto state = std::make_shared<MessageAwaitable::State>(token.executor);
+  start_reception();
+  {
+    const std::lock_guard<std::mutex> lock(dispatcher_mutex_);
+    if (dispatcher_ || (rcv_queue_type_ == AstarteReceptionQueue::kMulticast)) {
+      const std::string_view msg(
+          "Messages can not be awaited while the dispatcher or the multicast queue are used.");
+      spdlog::warn(msg);
+      state->complete(astarte_tl::unexpected(AstarteOperationRefusedError{msg}));
+      return MessageAwaitable(state);
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(rcv_waiters_mutex_);
+  // Pairs with the fence of the reception thread, either the queued message is seen here or the
+  // reception thread sees the waiter
+  rcv_waiters_count_.fetch_add(1, std::memory_order_seq_cst);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::optional<AstarteMessage> message;
+  if (rcv_waiters_.empty()) {
+    message = rcv_queue_->pop(std::chrono::milliseconds(0));
+  }
+  if (!message) {
+    rcv_waiters_.push_back(state);
+    return MessageAwaitable(state);
+  }
+  rcv_waiters_count_.fetch_sub(1, std::memory_order_seq_cst);
+  lock.unlock();
+  update_rcv_notifier();
+  state->complete(std::move(message.value()));
+  return MessageAwaitable(state);
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::complete_rcv_waiters() {
+  std::vector<std::pair<std::shared_ptr<MessageAwaitable::State>, AstarteMessage>> ready;
+  {
+    const std::lock_guard<std::mutex> lock(rcv_waiters_mutex_);
+    while (!rcv_waiters_.empty()) {
+      std::optional<AstarteMessage> message = rcv_queue_->pop(std::chrono::milliseconds(0));
+      if (!message) {
+        break;
+      }
+      ready.emplace_back(std::move(rcv_waiters_.front()), std::move(message.value()));
+      rcv_waiters_.pop_front();
+      rcv_waiters_count_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+  }
+  if (!ready.empty()) {
+    update_rcv_notifier();
+  }
+  // Coroutines are resumed outside of the lock, they might wait for the next message
+  for (auto& [waiter, message] : ready) {
+    waiter->complete(std::move(message));
   }
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::poll_incoming(
+    const std::chrono::milliseconds& timeout) -> std::optional<AstarteMessage> {
+  start_reception();
+  if (multicast_queue_) {
+    spdlog::warn("Messages can not be polled while the multicast queue is used.");
+    return std::nullopt;
+  }
+  std::optional<AstarteMessage> message = rcv_queue_->pop(timeout);
+  update_rcv_notifier();
+  return message;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::poll_incoming_batch(
+    std::vector<AstarteMessage>& out, std::size_t max, std::chrono::milliseconds timeout)
+    -> std::size_t {
+  start_reception();
+  if (multicast_queue_) {
+    spdlog::warn("Messages can not be polled while the multicast queue is used.");
+    return 0;
+  }
+  const std::size_t count = rcv_queue_->pop_batch(out, max, timeout);
+  update_rcv_notifier();
+  return count;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::native_handle()
+    -> astarte_tl::expected<int, AstarteError> {
+  start_reception();
+  if (multicast_queue_) {
+    const std::string_view msg("The native handle is not supported by the multicast queue.");
+    spdlog::warn(msg);
+    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+  }
+  const std::lock_guard<std::mutex> lock(rcv_notifier_mutex_);
+  if (!rcv_notifier_) {
+    auto notifier = EventNotifier::create();
+    if (!notifier) {
+      return astarte_tl::unexpected(notifier.error());
+    }
+    rcv_notifier_ = std::move(notifier.value());
+    // Messages might have been received before the creation of the notifier
+    if (!rcv_queue_->empty()) {
+      rcv_notifier_->signal();
+    }
+    rcv_notifier_enabled_.store(true, std::memory_order_release);
+  }
+  return rcv_notifier_->native_handle();
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::update_rcv_notifier() {
+  if (!rcv_notifier_enabled_.load(std::memory_order_acquire) || !rcv_queue_->empty()) {
+    return;
+  }
+  rcv_notifier_->clear();
+  // A message might have been received right before clearing the notifier
+  if (!rcv_queue_->empty()) {
+    rcv_notifier_->signal();
+  }
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_message_handler(AstarteMessageHandler handler,
+                                                                   std::size_t workers)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Setting message handler, workers: {}", workers);
+  if (handler && (workers == 0)) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"The number of dispatcher workers should be greater than zero."});
+  }
+  if (handler) {
+    start_reception();
+  }
+
+  std::unique_lock<std::mutex> lock(dispatcher_mutex_);
+  if (handler && (rcv_queue_type_ == AstarteReceptionQueue::kMulticast)) {
+    return astarte_tl::unexpected(AstarteOperationRefusedError{
+        "Message handlers are not supported by the multicast reception queue."});
+  }
+  if (handler && (workers > 1) && (rcv_queue_type_ == AstarteReceptionQueue::kSingleConsumer)) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{
+        "Multiple dispatcher workers require a multi consumer reception queue."});
+  }
+  message_handler_ = std::move(handler);
+  if (message_handler_) {
+    dispatcher_workers_ = workers;
+  }
+  auto replaced = restart_dispatcher();
+  // The replaced workers might be waiting for the mutex in a handler
+  lock.unlock();
+  replaced.clear();
   return {};
 }
 
-auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::unset_property(std::string_view interface_name,
-                                                              std::string_view path)
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::subscribe(std::string_view interface_name,
+                                                         std::string_view path_pattern,
+                                                         AstarteMessageHandler handler)
+    -> astarte_tl::expected<AstarteSubscriptionId, AstarteError> {
+  spdlog::debug("Subscribing to: {} {}", interface_name, path_pattern);
+  start_reception();
+  if (rcv_queue_type_ == AstarteReceptionQueue::kMulticast) {
+    return astarte_tl::unexpected(AstarteOperationRefusedError{
+        "Subscriptions are not supported by the multicast reception queue."});
+  }
+  auto subscription = router_.subscribe(interface_name, path_pattern, std::move(handler));
+  if (!subscription) {
+    return subscription;
+  }
+  std::unique_lock<std::mutex> lock(dispatcher_mutex_);
+  if (!dispatcher_) {
+    auto replaced = restart_dispatcher();
+    lock.unlock();
+    replaced.clear();
+  }
+  return subscription;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::unsubscribe(AstarteSubscriptionId subscription)
     -> astarte_tl::expected<void, AstarteError> {
-  spdlog::debug("Unsetting property: {} {}", interface_name, path);
-  if (!connected_.load()) {
-    const std::string_view msg("Device disconnected, operation aborted.");
+  spdlog::debug("Unsubscribing: {}", subscription);
+  if (!router_.unsubscribe(subscription)) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{"Unknown subscription."});
+  }
+  return {};
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::restart_dispatcher()
+    -> std::vector<std::unique_ptr<MessageDispatcher>> {
+  // Stop the workers of the previous handler, if any, before replacing it
+  if (dispatcher_) {
+    dispatcher_->request_stop();
+    retired_dispatchers_.push_back(std::move(dispatcher_));
+  }
+  // A dispatcher can't be joined by one of its workers, as when a handler sets a new handler. It's
+  // kept until it's replaced again from another thread or the device is destroyed.
+  std::vector<std::unique_ptr<MessageDispatcher>> replaced;
+  std::erase_if(retired_dispatchers_, [&replaced](std::unique_ptr<MessageDispatcher>& retired) {
+    if (retired->runs_on_current_thread()) {
+      return false;
+    }
+    replaced.push_back(std::move(retired));
+    return true;
+  });
+  if (!message_handler_ && router_.empty()) {
+    return replaced;
+  }
+  dispatcher_ = std::make_unique<MessageDispatcher>(
+      *rcv_queue_,
+      [this, handler = message_handler_](const AstarteMessage& message) {
+        if ((router_.route(message) == 0) && handler) {
+          handler(message);
+        }
+      },
+      dispatcher_workers_);
+  return replaced;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_reception_queue(AstarteReceptionQueue type,
+                                                                   std::size_t capacity,
+                                                                   AstarteOverflowPolicy policy)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Setting reception queue: {}, capacity: {}, policy: {}",
+                reception_queue_as_str(type), capacity, overflow_policy_as_str(policy));
+  if (policy == AstarteOverflowPolicy::kFail) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"The fail policy is not supported by the reception queue."});
+  }
+  if ((policy == AstarteOverflowPolicy::kDropOldest) &&
+      (type == AstarteReceptionQueue::kSingleConsumer)) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{
+        "The drop oldest policy requires a multi consumer reception queue."});
+  }
+  // Held while replacing the queues, a concurrent first use waits for the new ones
+  const std::lock_guard<std::mutex> lock(rcv_start_mutex_);
+  if (rcv_started_.load(std::memory_order_relaxed)) {
+    const std::string_view msg(
+        "The reception queue can only be set before the device is connected or used to receive.");
     spdlog::warn(msg);
     return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
   }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
 
-  const std::optional<AstarteData> opt_data = std::nullopt;
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstartePropertyIndividual> grpc_property_individual = converter(opt_data);
-  message.set_allocated_property_individual(grpc_property_individual.release());
+  // No message could have been received yet, the previous queues are empty
+  if (type == AstarteReceptionQueue::kMulticast) {
+    rcv_queue_ = make_reception_queue(AstarteReceptionQueue::kMultiConsumer);
+    multicast_queue_ = std::make_unique<MulticastQueue<AstarteMessage>>(capacity, policy);
+  } else {
+    rcv_queue_ = make_reception_queue(type, capacity, policy);
+    multicast_queue_.reset();
+  }
+  rcv_queue_type_ = type;
+  return {};
+}
 
-  ClientContext context;
-  google::protobuf::Empty response;
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    return astarte_tl::unexpected(AstarteGrpcLibError{
-        static_cast<std::uint64_t>(status.error_code()), status.error_message()});
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::start_reception() {
+  if (rcv_started_.load(std::memory_order_acquire)) {
+    return;
   }
+  // Waits for a concurrent set_reception_queue, which is refused from now on
+  const std::lock_guard<std::mutex> lock(rcv_start_mutex_);
+  rcv_started_.store(true, std::memory_order_release);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_decode_workers(std::size_t workers)
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Setting decode workers: {}", workers);
+  if (connection_thread_) {
+    const std::string_view msg("The decode workers can only be set while disconnected.");
+    spdlog::warn(msg);
+    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+  }
+  decode_workers_ = workers;
   return {};
 }
 
-auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::poll_incoming(
-    const std::chrono::milliseconds& timeout) -> std::optional<AstarteMessage> {
-  return rcv_queue_.pop(timeout);
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_dropped_messages() -> std::uint64_t {
+  // The queues might be being replaced by set_reception_queue
+  const std::lock_guard<std::mutex> lock(rcv_start_mutex_);
+  return multicast_queue_ ? multicast_queue_->dropped() : rcv_queue_->dropped();
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::add_message_consumer()
+    -> astarte_tl::expected<std::shared_ptr<MulticastQueue<AstarteMessage>::Subscriber>,
+                            AstarteError> {
+  spdlog::debug("Adding message consumer.");
+  start_reception();
+  if (!multicast_queue_) {
+    const std::string_view msg("Message consumers require a multicast reception queue.");
+    spdlog::warn(msg);
+    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+  }
+  return multicast_queue_->subscribe();
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::make_reception_queue(AstarteReceptionQueue type,
+                                                                    std::size_t capacity,
+                                                                    AstarteOverflowPolicy policy)
+    -> std::unique_ptr<BlockingQueue<AstarteMessage>> {
+  switch (type) {
+    case AstarteReceptionQueue::kSingleConsumer:
+      return std::make_unique<SpscQueue<AstarteMessage>>(capacity, policy);
+    case AstarteReceptionQueue::kConflating:
+      return std::make_unique<ConflatingQueue<AstarteMessage, PropertyConflationKey>>(capacity,
+                                                                                      policy);
+    // The multicast queue is not a blocking queue, it's created by set_reception_queue
+    case AstarteReceptionQueue::kMulticast:
+    case AstarteReceptionQueue::kMultiConsumer:
+      break;
+  }
+  return std::make_unique<SharedQueue<AstarteMessage>>(capacity, policy);
 }
 
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_all_properties(
@@ -374,7 +1050,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_all_properties(
 
   ClientContext context;
   gRPCStoredProperties response;
-  const Status status = stub_->GetAllProperties(&context, filter, &response);
+  const Status status = stub()->GetAllProperties(&context, filter, &response);
   if (!status.ok()) {
     spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     return astarte_tl::unexpected(AstarteGrpcLibError(
@@ -398,7 +1074,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_properties(std::string_view i
 
   ClientContext context;
   gRPCStoredProperties response;
-  const Status status = stub_->GetProperties(&context, grpc_interface_name, &response);
+  const Status status = stub()->GetProperties(&context, grpc_interface_name, &response);
   if (!status.ok()) {
     spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     return astarte_tl::unexpected(AstarteGrpcLibError(
@@ -424,7 +1100,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_property(std::string_view int
 
   ClientContext context;
   gRPCAstartePropertyIndividual response;
-  const Status status = stub_->GetProperty(&context, identifier, &response);
+  const Status status = stub()->GetProperty(&context, identifier, &response);
   if (!status.ok()) {
     spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     return astarte_tl::unexpected(AstarteGrpcLibError(
@@ -434,6 +1110,388 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::get_property(std::string_view int
   return GrpcConverterFrom{}(response);
 }
 
+template <typename Data>
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::make_individual_message(
+    GrpcMessageArena* arena, std::string_view interface_name, std::string_view path, Data&& data,
+    const std::chrono::system_clock::time_point* timestamp) -> gRPCAstarteMessage* {
+  auto* message = arena->create<gRPCAstarteMessage>();
+  message->set_interface_name(interface_name);
+  message->set_path(path);
+  GrpcConverterTo::fill(std::forward<Data>(data), timestamp,
+                        message->mutable_datastream_individual());
+  return message;
+}
+
+template <typename Object>
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::make_object_message(
+    GrpcMessageArena* arena, std::string_view interface_name, std::string_view path,
+    Object&& object, const std::chrono::system_clock::time_point* timestamp)
+    -> gRPCAstarteMessage* {
+  auto* message = arena->create<gRPCAstarteMessage>();
+  message->set_interface_name(interface_name);
+  message->set_path(path);
+  GrpcConverterTo::fill(std::forward<Object>(object), timestamp,
+                        message->mutable_datastream_object());
+  return message;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::make_property_message(
+    GrpcMessageArena* arena, std::string_view interface_name, std::string_view path,
+    std::optional<AstarteData> data) -> gRPCAstarteMessage* {
+  auto* message = arena->create<gRPCAstarteMessage>();
+  message->set_interface_name(interface_name);
+  message->set_path(path);
+  GrpcConverterTo::fill(std::move(data), message->mutable_property_individual());
+  return message;
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_message(const gRPCAstarteMessage& message,
+                                                            const AstarteMapping* mapping)
+    -> astarte_tl::expected<void, AstarteError> {
+  if (auto valid = validate_message(message, mapping); !valid) {
+    return valid;
+  }
+  if (auto buffered = buffer_message(message, mapping)) {
+    return buffered.value();
+  }
+  if (!connected_.load()) {
+    const std::string_view msg("Device disconnected, operation aborted.");
+    spdlog::warn(msg);
+    return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+  }
+
+  // When the outbound queue is enabled the message will be transmitted by the sender thread
+  if (outbound_queue_) {
+    spdlog::trace("Queueing data: {} {}", message.interface_name(), message.path());
+    // The queued message is copied out of the arena of the caller. Messages discarded by the drop
+    // newest policy are counted by the queue, not reported as errors.
+    if (!outbound_queue_->push(message) &&
+        (outbound_queue_->policy() != AstarteOverflowPolicy::kDropNewest)) {
+      const std::string_view msg("Outbound queue full, operation aborted.");
+      spdlog::warn(msg);
+      return astarte_tl::unexpected(AstarteOperationRefusedError{msg});
+    }
+    return {};
+  }
+
+  return transmit_or_store(message, mapping);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::validate_message(
+    const gRPCAstarteMessage& message, const AstarteMapping* known_mapping)
+    -> astarte_tl::expected<void, AstarteError> {
+  const std::string& path = message.path();
+  // Prepared endpoints have been validated when created, only the data is left to check
+  if ((known_mapping != nullptr) && !message.has_datastream_object()) {
+    const bool valid =
+        message.has_datastream_individual()
+            ? data_matches_mapping(message.datastream_individual().data(), *known_mapping)
+            : (!message.property_individual().has_data() ||
+               data_matches_mapping(message.property_individual().data(), *known_mapping));
+    return valid ? astarte_tl::expected<void, AstarteError>{}
+                 : astarte_tl::unexpected(type_mismatch(message, path));
+  }
+
+  const std::shared_lock<std::shared_mutex> lock(interfaces_mutex_);
+  auto iter = interfaces_.find(message.interface_name());
+  if (iter == interfaces_.end()) {
+    if (unvalidated_interfaces_.contains(message.interface_name())) {
+      return {};
+    }
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"Interface not found: " + message.interface_name()});
+  }
+  const AstarteInterface& interface = iter->second;
+  if (interface.ownership() != AstarteOwnership::kDevice) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"Interface not owned by the device: " + interface.name()});
+  }
+  if ((message.has_property_individual() !=
+       (interface.type() == AstarteInterfaceType::kProperties)) ||
+      (message.has_datastream_object() !=
+       (interface.aggregation() == AstarteAggregation::kObject))) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"Operation not supported by the interface " + interface.name()});
+  }
+  const AstarteMapping* mapping = interface.find_mapping(path);
+  if (mapping == nullptr) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{
+        "Path not matching any mapping of " + interface.name() + ": " + path});
+  }
+
+  if (message.has_datastream_object()) {
+    for (const auto& [field, data] : message.datastream_object().data()) {
+      const AstarteMapping* field_mapping = interface.find_object_field(path, field);
+      if (field_mapping == nullptr) {
+        return astarte_tl::unexpected(AstarteInvalidInputError{
+            "Path not matching any mapping of " + interface.name() + ": " + path + "/" + field});
+      }
+      if (!data_matches_mapping(data, *field_mapping)) {
+        return astarte_tl::unexpected(type_mismatch(message, path + "/" + field));
+      }
+    }
+    return {};
+  }
+  const bool valid =
+      message.has_datastream_individual()
+          ? data_matches_mapping(message.datastream_individual().data(), *mapping)
+          : (!message.property_individual().has_data() ||
+             data_matches_mapping(message.property_individual().data(), *mapping));
+  return valid ? astarte_tl::expected<void, AstarteError>{}
+               : astarte_tl::unexpected(type_mismatch(message, path));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::transmit_message(const gRPCAstarteMessage& message)
+    -> astarte_tl::expected<void, AstarteError> {
+  ClientContext context;
+  google::protobuf::Empty response;
+  spdlog::trace("Sending data: {} {}", message.interface_name(), message.path());
+  const Status status = stub()->Send(&context, message, &response);
+  if (!status.ok()) {
+    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+    return astarte_tl::unexpected(AstarteGrpcLibError{
+        static_cast<std::uint64_t>(status.error_code()), status.error_message()});
+  }
+  return {};
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::transmit_or_store(const gRPCAstarteMessage& message,
+                                                                 const AstarteMapping* mapping)
+    -> astarte_tl::expected<void, AstarteError> {
+  auto res = transmit_message(message);
+  if (res || !store_forward_ || message.has_property_individual()) {
+    return res;
+  }
+  auto stored = store_message(message, mapping);
+  if (stored && stored->has_value()) {
+    spdlog::warn("Failed to transmit message, stored for replay: {} {}", message.interface_name(),
+                 message.path());
+    return {};
+  }
+  return res;
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::start_send_call(
+    const gRPCAstarteMessage& message, GrpcAsyncSendCall::Callback callback) {
+  const std::shared_ptr<gRPCMessageHub::Stub> current_stub = stub();
+  if (!store_forward_ || message.has_property_individual()) {
+    GrpcAsyncSendCall::start(current_stub.get(), completion_queue(), message, std::move(callback));
+    return;
+  }
+  // The message is kept until the call completes, to be stored if the transmission fails
+  GrpcAsyncSendCall::start(
+      current_stub.get(), completion_queue(), message,
+      [this, message,
+       callback = std::move(callback)](astarte_tl::expected<void, AstarteError> res) {
+        if (!res) {
+          auto stored = store_message(message, nullptr);
+          if (stored && stored->has_value()) {
+            spdlog::warn("Failed to transmit message, stored for replay: {} {}",
+                         message.interface_name(), message.path());
+            res = {};
+          }
+        }
+        callback(std::move(res));
+      });
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::buffer_message(const gRPCAstarteMessage& message,
+                                                              const AstarteMapping* known_mapping)
+    -> std::optional<astarte_tl::expected<void, AstarteError>> {
+  // Only datastreams are buffered while disconnected. Once connected new data is sent directly,
+  // the replay rate limits only the backlog and a producer faster than it is never throttled.
+  if (!store_forward_ || message.has_property_individual() || connected_.load()) {
+    return std::nullopt;
+  }
+  return store_message(message, known_mapping);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::store_message(const gRPCAstarteMessage& message,
+                                                             const AstarteMapping* known_mapping)
+    -> std::optional<astarte_tl::expected<void, AstarteError>> {
+  // Prepared endpoints provide their mapping, skipping the lookup
+  std::optional<AstarteMapping> mapping;
+  if (known_mapping != nullptr) {
+    mapping = *known_mapping;
+  } else {
+    const std::shared_lock<std::shared_mutex> lock(interfaces_mutex_);
+    auto interface = interfaces_.find(message.interface_name());
+    if (interface != interfaces_.end()) {
+      if (const AstarteMapping* found = interface->second.find_mapping(message.path())) {
+        mapping = *found;
+      }
+    }
+  }
+  if (!mapping || (mapping->retention == AstarteRetention::kDiscard)) {
+    return std::nullopt;
+  }
+
+  spdlog::trace("Buffering data: {} {}", message.interface_name(), message.path());
+  // Preserve the time the data was generated, instead of the time it will be replayed at
+  const bool has_timestamp =
+      (message.has_datastream_individual() && message.datastream_individual().has_timestamp()) ||
+      (message.has_datastream_object() && message.datastream_object().has_timestamp());
+  if (mapping->explicit_timestamp && !has_timestamp) {
+    gRPCAstarteMessage stamped = message;
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    const auto sec = std::chrono::duration_cast<std::chrono::seconds>(now);
+    const auto nano = std::chrono::duration_cast<std::chrono::nanoseconds>(now) - sec;
+    google::protobuf::Timestamp* timestamp = stamped.has_datastream_individual()
+                                                 ? stamped.mutable_datastream_individual()
+                                                       ->mutable_timestamp()
+                                                 : stamped.mutable_datastream_object()
+                                                       ->mutable_timestamp();
+    timestamp->set_seconds(static_cast<int64_t>(sec.count()));
+    timestamp->set_nanos(static_cast<int32_t>(nano.count()));
+    return store_forward_->push(stamped, mapping->retention, mapping->expiry);
+  }
+  return store_forward_->push(message, mapping->retention, mapping->expiry);
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::replay_loop(const std::stop_token& token) {
+  spdlog::debug("Replay of the buffered messages has been started");
+  const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::seconds(1)) / replay_rate_;
+  std::mutex mutex;
+  std::condition_variable_any condition;
+  auto next_send = std::chrono::steady_clock::now();
+  while (!token.stop_requested()) {
+    std::optional<StoreForwardBuffer::Entry> entry =
+        store_forward_->front(std::chrono::milliseconds(sender_idle_interval_ms));
+    if (!entry) {
+      continue;
+    }
+    // Limit the transmission rate, waking up early if a stop is requested
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait_until(lock, token, next_send, [] { return false; });
+    lock.unlock();
+    if (token.stop_requested()) {
+      break;
+    }
+    next_send = std::max(next_send, std::chrono::steady_clock::now()) + interval;
+
+    // Pushes performed during the transmission might have discarded the transmitted message
+    if (transmit_message(entry->message)) {
+      store_forward_->pop(entry->seq);
+    } else {
+      spdlog::warn("Failed to replay buffered message: {} {}", entry->message.interface_name(),
+                   entry->message.path());
+    }
+  }
+  spdlog::debug("Replay of the buffered messages has been terminated");
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::sender_loop(const std::stop_token& token) {
+  spdlog::debug("Outbound queue sender thread has been started");
+  while (!token.stop_requested()) {
+    // Messages are kept in the queue while the device is disconnected
+    if (!connected_.load()) {
+      std::unique_lock<std::mutex> lock(connected_mutex_);
+      connected_cv_.wait(lock, token, [this]() { return connected_.load(); });
+      continue;
+    }
+    std::optional<gRPCAstarteMessage> message =
+        outbound_queue_->pop(std::chrono::milliseconds(sender_idle_interval_ms));
+    if (!message) {
+      continue;
+    }
+    // The caller has already been answered, the message is kept for the replay if possible
+    if (transmit_or_store(message.value(), nullptr)) {
+      continue;
+    }
+    failed_messages_.fetch_add(1, std::memory_order_relaxed);
+    spdlog::error("Failed to transmit queued message: {} {}", message->interface_name(),
+                  message->path());
+  }
+  spdlog::debug("Outbound queue sender thread has been terminated");
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_message_async(
+    const gRPCAstarteMessage& message) -> std::future<astarte_tl::expected<void, AstarteError>> {
+  auto promise = std::make_shared<std::promise<astarte_tl::expected<void, AstarteError>>>();
+  std::future<astarte_tl::expected<void, AstarteError>> future = promise->get_future();
+  send_message_async(message, [promise](astarte_tl::expected<void, AstarteError> res) {
+    promise->set_value(std::move(res));
+  });
+  return future;
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_message_async(
+    const gRPCAstarteMessage& message, GrpcAsyncSendCall::Callback callback) {
+  if (auto valid = validate_message(message); !valid) {
+    callback(std::move(valid));
+    return;
+  }
+  if (auto buffered = buffer_message(message)) {
+    callback(std::move(buffered.value()));
+    return;
+  }
+  if (!connected_.load()) {
+    const std::string_view msg("Device disconnected, operation aborted.");
+    spdlog::warn(msg);
+    callback(astarte_tl::unexpected(AstarteOperationRefusedError{msg}));
+    return;
+  }
+
+  spdlog::trace("Sending data asynchronously: {} {}", message.interface_name(), message.path());
+  start_send_call(message, std::move(callback));
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::send_message_awaitable(
+    const gRPCAstarteMessage& message, const AstarteUseAwaitable& token) -> SendAwaitable {
+  auto state = std::make_shared<SendAwaitable::State>(token.executor);
+  send_message_async(message, [state](astarte_tl::expected<void, AstarteError> res) {
+    state->complete(std::move(res));
+  });
+  return SendAwaitable(state);
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::fill_message(
+    const AstarteOutgoingMessage& outgoing, gRPCAstarteMessage* message) {
+  message->set_interface_name(outgoing.get_interface());
+  message->set_path(outgoing.get_path());
+
+  const auto& timestamp = outgoing.get_timestamp();
+  const std::chrono::system_clock::time_point* timestamp_ptr =
+      timestamp.has_value() ? &timestamp.value() : nullptr;
+
+  // Payloads of the same kind are overwritten in place, arrays keep their previous capacity
+  const auto& data = outgoing.get_raw_data();
+  if (const auto* individual = std::get_if<AstarteDatastreamIndividual>(&data)) {
+    GrpcConverterTo::fill(individual->get_value(), timestamp_ptr,
+                          message->mutable_datastream_individual());
+  } else if (const auto* object = std::get_if<AstarteDatastreamObject>(&data)) {
+    GrpcConverterTo::fill(*object, timestamp_ptr, message->mutable_datastream_object());
+  } else {
+    const auto& property = std::get<AstartePropertyIndividual>(data);
+    GrpcConverterTo::fill(property.get_value(), message->mutable_property_individual());
+  }
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::completion_queue() -> grpc::CompletionQueue* {
+  // The completion queue thread is only started the first time it's needed
+  std::call_once(cq_thread_flag_,
+                 [this]() { cq_thread_ = std::make_unique<GrpcCompletionQueueThread>(); });
+  return cq_thread_->queue();
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::on_completion_queue_thread() -> bool {
+  // Going through completion_queue() synchronizes with the creation of the thread
+  completion_queue();
+  return cq_thread_->is_current();
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::stop_outbound_queue() {
+  if (outbound_queue_) {
+    outbound_queue_->close();
+  }
+  // jthread's destructor will request a stop and join
+  sender_thread_.reset();
+  if (outbound_queue_ && !outbound_queue_->empty()) {
+    spdlog::warn("Discarding {} messages from the outbound queue", outbound_queue_->size());
+  }
+}
+
 // Private helper to set up the gRPC channel and stub
 void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::setup_grpc_channel() {
   const grpc::ChannelArguments args;
@@ -443,7 +1501,24 @@ void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::setup_grpc_channel() {
   const std::shared_ptr<Channel> channel = CreateCustomChannelWithInterceptors(
       server_addr_, grpc::InsecureChannelCredentials(), args, std::move(interceptor_creators));
 
-  stub_ = gRPCMessageHub::NewStub(channel);
+  std::shared_ptr<gRPCMessageHub::Stub> stub = gRPCMessageHub::NewStub(channel);
+  const std::lock_guard<std::mutex> lock(stub_mutex_);
+  stub_ = std::move(stub);
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::stub() const
+    -> std::shared_ptr<gRPCMessageHub::Stub> {
+  const std::lock_guard<std::mutex> lock(stub_mutex_);
+  return stub_;
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::set_connected(bool connected) {
+  {
+    // Stored under the mutex, so that a waiter can't miss the notification
+    const std::lock_guard<std::mutex> lock(connected_mutex_);
+    connected_.store(connected);
+  }
+  connected_cv_.notify_all();
 }
 
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::perform_attach()
@@ -460,7 +1535,7 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::perform_attach()
   // least for that long.
   // See: https://grpc.github.io/grpc/cpp/classgrpc_1_1_client_context.html
   std::unique_ptr<ClientContext> context = std::make_unique<ClientContext>();
-  std::unique_ptr<ClientReader<gRPCMessageHubEvent>> reader = stub_->Attach(context.get(), node);
+  std::unique_ptr<ClientReader<gRPCMessageHubEvent>> reader = stub()->Attach(context.get(), node);
 
   reader->WaitForInitialMetadata();
   auto server_metadata = context->GetServerInitialMetadata();
@@ -493,13 +1568,22 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::connection_attempt(const std::sto
         return error;
       })
       .and_then([&](auto&& attach_res) {
-        connected_.store(true);
+        set_connected(true);
         spdlog::info("Node connected");
-        return handle_events(token, std::move(attach_res.context), std::move(attach_res.reader));
-      })
-      .transform([&]() {
-        connected_.store(false);
+        // Replay the buffered messages while handling the events, the replay thread is stopped
+        // and joined when the event stream terminates
+        std::optional<std::jthread> replay_thread;
+        if (store_forward_) {
+          replay_thread.emplace(
+              [this](const std::stop_token& replay_token) { this->replay_loop(replay_token); });
+        }
+        auto res =
+            handle_events(token, std::move(attach_res.context), std::move(attach_res.reader));
+        // The stream is over even when it failed, the next attempt should find the device
+        // disconnected and new data should be buffered instead of sent to a dead stream
+        set_connected(false);
         spdlog::info("Node disconnected");
+        return res;
       });
 }
 
@@ -507,17 +1591,14 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::handle_events(
     const std::stop_token& token, std::unique_ptr<grpc::ClientContext> context,
     std::unique_ptr<ClientReader<gRPCMessageHubEvent>> reader)
     -> astarte_tl::expected<void, AstarteError> {
-  (void)context;
   spdlog::debug("Event handler thread has been started");
+  // A stop request unblocks the pending read by cancelling the stream
+  const std::stop_callback cancel_stream(token, [&context]() { context->TryCancel(); });
 
-  gRPCMessageHubEvent msghub_event;
-  while (!token.stop_requested() && reader->Read(&msghub_event)) {
-    spdlog::debug("Event from the message hub received.");
-    auto parsed_message = AstarteDeviceGrpcImpl::parse_message_hub_event(msghub_event);
-    if (!parsed_message) {
-      return astarte_tl::unexpected(parsed_message.error());
-    }
-    this->rcv_queue_.push(parsed_message.value());
+  auto read = (decode_workers_ > 0) ? read_events_pooled(token, *reader)
+                                    : read_events(token, *reader);
+  if (!read) {
+    return read;
   }
   spdlog::info("Message hub stream has been interrupted.");
 
@@ -537,12 +1618,147 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::handle_events(
   return {};
 }
 
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::read_events(
+    const std::stop_token& token, ClientReader<gRPCMessageHubEvent>& reader)
+    -> astarte_tl::expected<void, AstarteError> {
+  // Each event is parsed on the arena, which is reset once the event has been converted
+  GrpcMessageArena arena;
+  InterfacesSnapshot snapshot;
+  gRPCMessageHubEvent* msghub_event = arena.create<gRPCMessageHubEvent>();
+  while (!token.stop_requested() && reader.Read(msghub_event)) {
+    spdlog::debug("Event from the message hub received.");
+    refresh_interfaces(snapshot);
+    // The event is consumed, its payloads are moved into the parsed message
+    auto parsed_message =
+        AstarteDeviceGrpcImpl::parse_message_hub_event(*msghub_event, snapshot.interfaces.get());
+    if (!parsed_message) {
+      return astarte_tl::unexpected(parsed_message.error());
+    }
+    publish_message(std::move(parsed_message.value()), token);
+    arena.reset();
+    msghub_event = arena.create<gRPCMessageHubEvent>();
+  }
+  return {};
+}
+
+auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::read_events_pooled(
+    const std::stop_token& token, ClientReader<gRPCMessageHubEvent>& reader)
+    -> astarte_tl::expected<void, AstarteError> {
+  // A conversion failed on a worker ends the stream, as done by the inline conversion
+  std::mutex decode_error_mutex;
+  std::optional<AstarteError> decode_error;
+  std::atomic_bool decode_failed{false};
+  // The reception queue might support a single producer
+  std::mutex publish_mutex;
+  // Each event is parsed on its own arena, handed back by the workers once the event is converted
+  std::mutex arenas_mutex;
+  std::vector<std::unique_ptr<GrpcMessageArena>> arenas;
+  auto release_arena = [&arenas_mutex, &arenas](std::unique_ptr<GrpcMessageArena> arena) {
+    arena->reset();
+    const std::lock_guard<std::mutex> lock(arenas_mutex);
+    arenas.push_back(std::move(arena));
+  };
+  auto acquire_arena = [&arenas_mutex, &arenas]() {
+    const std::lock_guard<std::mutex> lock(arenas_mutex);
+    if (arenas.empty()) {
+      return std::make_unique<GrpcMessageArena>();
+    }
+    auto arena = std::move(arenas.back());
+    arenas.pop_back();
+    return arena;
+  };
+  {
+    OrderedWorkerPool<PooledEvent> decoders(
+        decode_workers_, decode_queue_capacity, [&](PooledEvent&& pooled) {
+          auto parsed_message = AstarteDeviceGrpcImpl::parse_message_hub_event(
+              *pooled.event, pooled.interfaces.get());
+          release_arena(std::move(pooled.arena));
+          if (!parsed_message) {
+            const std::lock_guard<std::mutex> lock(decode_error_mutex);
+            if (!decode_error) {
+              decode_error = parsed_message.error();
+            }
+            decode_failed.store(true);
+            return;
+          }
+          const std::lock_guard<std::mutex> lock(publish_mutex);
+          publish_message(std::move(parsed_message.value()), token);
+        });
+
+    // Events are handed over to the workers, so each one is read into its own arena
+    InterfacesSnapshot snapshot;
+    PooledEvent pooled{.arena = acquire_arena(), .event = nullptr, .interfaces = nullptr};
+    pooled.event = pooled.arena->create<gRPCMessageHubEvent>();
+    while (!token.stop_requested() && !decode_failed.load() && reader.Read(pooled.event)) {
+      spdlog::debug("Event from the message hub received.");
+      refresh_interfaces(snapshot);
+      pooled.interfaces = snapshot.interfaces;
+      if (!pooled.event->has_message()) {
+        return astarte_tl::unexpected(
+            AstarteDeviceGrpcImpl::parse_message_hub_event(*pooled.event).error());
+      }
+      // Messages for the same interface and path are converted by the same worker, in order
+      const gRPCAstarteMessage& message = pooled.event->message();
+      std::size_t key = std::hash<std::string>{}(message.interface_name());
+      key ^= std::hash<std::string>{}(message.path()) + 0x9e3779b9 + (key << 6) + (key >> 2);
+      decoders.submit(key, std::move(pooled), token);
+      pooled.arena = acquire_arena();
+      pooled.event = pooled.arena->create<gRPCMessageHubEvent>();
+    }
+  }
+  // The workers have been joined
+  if (decode_error) {
+    return astarte_tl::unexpected(decode_error.value());
+  }
+  return {};
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::publish_message(AstarteMessage message,
+                                                               const std::stop_token& token) {
+  // Consumers of the multicast queue are served by their own queues
+  if (multicast_queue_) {
+    if (!multicast_queue_->push(std::move(message), token)) {
+      spdlog::debug("Message not delivered to any consumer");
+    }
+    return;
+  }
+  // With the block policy a full queue stops the reads, applying backpressure on the stream
+  if (!rcv_queue_->push(std::move(message), token)) {
+    spdlog::debug("Reception queue full, message dropped");
+  } else if (rcv_notifier_enabled_.load(std::memory_order_acquire) && (rcv_queue_->size() == 1)) {
+    // The queue was empty, the notifier is signaled only on this transition
+    rcv_notifier_->signal();
+  }
+  // Pairs with the fence of next_message
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (rcv_waiters_count_.load(std::memory_order_seq_cst) > 0) {
+    complete_rcv_waiters();
+  }
+}
+
+void AstarteDeviceGrpc::AstarteDeviceGrpcImpl::refresh_interfaces(InterfacesSnapshot& snapshot) {
+  const std::uint64_t generation = interfaces_generation_.load(std::memory_order_acquire);
+  if (snapshot.interfaces && (snapshot.generation == generation)) {
+    return;
+  }
+  const std::shared_lock<std::shared_mutex> lock(interfaces_mutex_);
+  snapshot.interfaces = std::make_shared<const InterfacesMap>(interfaces_);
+  snapshot.generation = generation;
+}
+
 auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::parse_message_hub_event(
-    const gRPCMessageHubEvent& event) -> astarte_tl::expected<AstarteMessage, AstarteError> {
+    gRPCMessageHubEvent& event, const InterfacesMap* interfaces)
+    -> astarte_tl::expected<AstarteMessage, AstarteError> {
   spdlog::trace("Parsing message hub event.");
   if (event.has_message()) {
-    const gRPCAstarteMessage& astarteMessage = event.message();
-    return GrpcConverterFrom{}(astarteMessage);
+    gRPCAstarteMessage& message = *event.mutable_message();
+    if (interfaces != nullptr) {
+      auto interface = interfaces->find(message.interface_name());
+      if (interface != interfaces->end()) {
+        return GrpcConverterFrom{}(std::move(message), interface->second);
+      }
+    }
+    return GrpcConverterFrom{}(std::move(message));
   }
   if (event.has_error()) {
     const gRPCMessageHubError& error = event.error();
@@ -579,7 +1795,11 @@ auto AstarteDeviceGrpc::AstarteDeviceGrpcImpl::connection_loop(const std::stop_t
           auto delay = exp_backoff.getNextDelay();
           spdlog::info("Will attempt to reconnect in {} seconds.",
                        std::chrono::duration_cast<std::chrono::seconds>(delay).count());
-          std::this_thread::sleep_for(delay);
+          // The wait is interrupted by a stop request
+          std::mutex delay_mutex;
+          std::condition_variable_any delay_cv;
+          std::unique_lock<std::mutex> delay_lock(delay_mutex);
+          delay_cv.wait_for(delay_lock, token, delay, []() { return false; });
         }
 
         spdlog::info("Connection loop has been terminated.");
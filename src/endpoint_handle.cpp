@@ -0,0 +1,189 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/endpoint_handle.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "endpoint_handle_impl.hpp"
+#include "grpc_converter.hpp"
+#include "interface.hpp"
+
+namespace AstarteDeviceSdk {
+
+auto AstarteEndpointHandle::AstarteEndpointHandleImpl::create(
+    const std::shared_ptr<AstarteDeviceGrpc::AstarteDeviceGrpcImpl>& device,
+    std::string_view interface_name, std::string_view path)
+    -> astarte_tl::expected<std::shared_ptr<AstarteEndpointHandleImpl>, AstarteError> {
+  spdlog::debug("Preparing endpoint: {} {}", interface_name, path);
+  auto endpoint = resolve(*device, interface_name, path);
+  if (!endpoint) {
+    return astarte_tl::unexpected(std::move(endpoint).error());
+  }
+
+  auto impl = std::make_shared<AstarteEndpointHandleImpl>();
+  impl->device = device;
+  impl->interface_name = interface_name;
+  impl->path = path;
+  impl->endpoint = std::move(endpoint.value());
+  return impl;
+}
+
+auto AstarteEndpointHandle::AstarteEndpointHandleImpl::resolve(
+    AstarteDeviceGrpc::AstarteDeviceGrpcImpl& device, std::string_view interface_name,
+    std::string_view path) -> astarte_tl::expected<Endpoint, AstarteError> {
+  // Read first, a change made while validating is caught by the next transmission
+  const std::uint64_t generation = device.get_interfaces_generation();
+  const std::optional<AstarteInterface> interface = device.find_interface(interface_name);
+  if (!interface) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"Interface not found: " + std::string(interface_name)});
+  }
+  if (interface->ownership() != AstarteOwnership::kDevice) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"Interface not owned by the device: " + interface->name()});
+  }
+  const AstarteMapping* mapping = interface->find_mapping(path);
+  if (mapping == nullptr) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{
+        "Path not matching any mapping of " + interface->name() + ": " + std::string(path)});
+  }
+  return Endpoint{.type = interface->type(),
+                  .aggregation = interface->aggregation(),
+                  .mapping = std::make_shared<const AstarteMapping>(*mapping),
+                  .generation = generation};
+}
+
+AstarteEndpointHandle::AstarteEndpointHandle(std::shared_ptr<AstarteEndpointHandleImpl> impl)
+    : endpoint_handle_impl_(std::move(impl)) {}
+
+auto AstarteEndpointHandle::get_interface() const -> const std::string& {
+  return endpoint_handle_impl_->interface_name;
+}
+
+auto AstarteEndpointHandle::get_path() const -> const std::string& {
+  return endpoint_handle_impl_->path;
+}
+
+template <typename Fill>
+auto AstarteEndpointHandle::send_with(bool datastream, bool object, Fill&& fill) const
+    -> astarte_tl::expected<void, AstarteError> {
+  AstarteEndpointHandleImpl& impl = *endpoint_handle_impl_;
+  auto device = impl.device.lock();
+  if (!device) {
+    return astarte_tl::unexpected(
+        AstarteOperationRefusedError{"The device of the endpoint has been destroyed."});
+  }
+
+  // Only the mapping and an idle message are taken under the lock, the transmission runs without
+  std::shared_ptr<const AstarteMapping> mapping;
+  std::unique_ptr<gRPCAstarteMessage> message;
+  {
+    const std::lock_guard<std::mutex> lock(impl.mutex);
+    if (impl.endpoint.generation != device->get_interfaces_generation()) {
+      auto endpoint = AstarteEndpointHandleImpl::resolve(*device, impl.interface_name, impl.path);
+      if (!endpoint) {
+        spdlog::warn("Endpoint no longer valid: {} {}", impl.interface_name, impl.path);
+        return astarte_tl::unexpected(std::move(endpoint).error());
+      }
+      impl.endpoint = std::move(endpoint.value());
+    }
+    if ((datastream != (impl.endpoint.type == AstarteInterfaceType::kDatastream)) ||
+        (object != (impl.endpoint.aggregation == AstarteAggregation::kObject))) {
+      return astarte_tl::unexpected(AstarteInvalidInputError{
+          "Operation not supported by the interface " + impl.interface_name});
+    }
+    mapping = impl.endpoint.mapping;
+    if (!impl.idle_messages.empty()) {
+      message = std::move(impl.idle_messages.back());
+      impl.idle_messages.pop_back();
+    }
+  }
+  if (!message) {
+    message = std::make_unique<gRPCAstarteMessage>();
+    message->set_interface_name(impl.interface_name);
+    message->set_path(impl.path);
+  }
+
+  std::forward<Fill>(fill)(message.get());
+  auto res = device->send_message(*message, mapping.get());
+
+  const std::lock_guard<std::mutex> lock(impl.mutex);
+  impl.idle_messages.push_back(std::move(message));
+  return res;
+}
+
+auto AstarteEndpointHandle::send_individual(
+    const AstarteData& data, const std::chrono::system_clock::time_point* timestamp) const
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending individual: {} {}", get_interface(), get_path());
+  return send_with(true, false, [&](gRPCAstarteMessage* message) {
+    GrpcConverterTo::fill(data, timestamp, message->mutable_datastream_individual());
+  });
+}
+
+auto AstarteEndpointHandle::send_individual(
+    AstarteData&& data, const std::chrono::system_clock::time_point* timestamp) const
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending individual: {} {}", get_interface(), get_path());
+  return send_with(true, false, [&](gRPCAstarteMessage* message) {
+    GrpcConverterTo::fill(std::move(data), timestamp, message->mutable_datastream_individual());
+  });
+}
+
+auto AstarteEndpointHandle::send_individual(
+    const AstarteDataView& data, const std::chrono::system_clock::time_point* timestamp) const
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending individual view: {} {}", get_interface(), get_path());
+  return send_with(true, false, [&](gRPCAstarteMessage* message) {
+    GrpcConverterTo::fill(data, timestamp, message->mutable_datastream_individual());
+  });
+}
+
+auto AstarteEndpointHandle::send_object(
+    const AstarteDatastreamObject& object,
+    const std::chrono::system_clock::time_point* timestamp) const
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Sending object: {} {}", get_interface(), get_path());
+  return send_with(true, true, [&](gRPCAstarteMessage* message) {
+    GrpcConverterTo::fill(object, timestamp, message->mutable_datastream_object());
+  });
+}
+
+auto AstarteEndpointHandle::set_property(const AstarteData& data) const
+    -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Setting property: {} {}", get_interface(), get_path());
+  return send_with(false, false, [&](gRPCAstarteMessage* message) {
+    GrpcConverterTo::fill(data, message->mutable_property_individual()->mutable_data());
+  });
+}
+
+auto AstarteEndpointHandle::unset_property() const -> astarte_tl::expected<void, AstarteError> {
+  spdlog::debug("Unsetting property: {} {}", get_interface(), get_path());
+  return send_with(false, false, [&](gRPCAstarteMessage* message) {
+    message->mutable_property_individual()->clear_data();
+  });
+}
+
+}  // namespace AstarteDeviceSdk
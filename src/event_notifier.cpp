@@ -0,0 +1,96 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "event_notifier.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+
+namespace AstarteDeviceSdk {
+
+EventNotifier::EventNotifier(int read_fd, int write_fd) : read_fd_(read_fd), write_fd_(write_fd) {}
+
+auto EventNotifier::create() -> astarte_tl::expected<std::unique_ptr<EventNotifier>, AstarteError> {
+#if defined(__linux__)
+  const int event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (event_fd < 0) {
+    return astarte_tl::unexpected(
+        AstarteInternalError{"Could not create the eventfd: " + std::string(strerror(errno))});
+  }
+  return std::unique_ptr<EventNotifier>(new EventNotifier(event_fd, event_fd));
+#elif defined(__unix__) || defined(__APPLE__)
+  std::array<int, 2> fds{};
+  if (pipe(fds.data()) != 0) {
+    return astarte_tl::unexpected(
+        AstarteInternalError{"Could not create the pipe: " + std::string(strerror(errno))});
+  }
+  for (const int pipe_fd : fds) {
+    fcntl(pipe_fd, F_SETFL, fcntl(pipe_fd, F_GETFL) | O_NONBLOCK);
+    fcntl(pipe_fd, F_SETFD, FD_CLOEXEC);
+  }
+  return std::unique_ptr<EventNotifier>(new EventNotifier(fds[0], fds[1]));
+#else
+  return astarte_tl::unexpected(
+      AstarteOperationRefusedError{"Event notifiers are not supported on this platform."});
+#endif
+}
+
+EventNotifier::~EventNotifier() {
+#if defined(__unix__) || defined(__APPLE__)
+  close(read_fd_);
+  if (write_fd_ != read_fd_) {
+    close(write_fd_);
+  }
+#endif
+}
+
+auto EventNotifier::native_handle() const -> int { return read_fd_; }
+
+void EventNotifier::signal() {
+#if defined(__linux__)
+  const std::uint64_t value = 1;
+  if (write(write_fd_, &value, sizeof(value)) < 0) {
+    spdlog::warn("Failed to signal the eventfd: {}", strerror(errno));
+  }
+#elif defined(__unix__) || defined(__APPLE__)
+  const char value = 1;
+  // A full pipe is already readable, the signal can be safely lost
+  (void)write(write_fd_, &value, sizeof(value));
+#endif
+}
+
+void EventNotifier::clear() {
+#if defined(__linux__)
+  std::uint64_t value = 0;
+  (void)read(read_fd_, &value, sizeof(value));
+#elif defined(__unix__) || defined(__APPLE__)
+  std::array<char, 64> buffer{};
+  while (read(read_fd_, buffer.data(), buffer.size()) > 0) {
+  }
+#endif
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,76 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "grpc_async.hpp"
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <spdlog/spdlog.h>
+
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+
+namespace AstarteDeviceSdk {
+
+GrpcCompletionQueueThread::GrpcCompletionQueueThread() : thread_([this] { run(); }) {}
+
+GrpcCompletionQueueThread::~GrpcCompletionQueueThread() {
+  cq_.Shutdown();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+auto GrpcCompletionQueueThread::queue() -> grpc::CompletionQueue* { return &cq_; }
+
+auto GrpcCompletionQueueThread::is_current() const -> bool {
+  return std::this_thread::get_id() == thread_.get_id();
+}
+
+void GrpcCompletionQueueThread::run() {
+  spdlog::debug("Completion queue thread has been started");
+  void* tag = nullptr;
+  bool ok = false;
+  while (cq_.Next(&tag, &ok)) {
+    static_cast<GrpcAsyncOperation*>(tag)->complete(ok);
+  }
+  spdlog::debug("Completion queue thread has been terminated");
+}
+
+GrpcAsyncSendCall::GrpcAsyncSendCall(Callback callback) : callback_(std::move(callback)) {}
+
+void GrpcAsyncSendCall::start(gRPCMessageHub::Stub* stub, grpc::CompletionQueue* cq,
+                              const gRPCAstarteMessage& message, Callback callback) {
+  // Ownership is passed to the completion queue, the call will be released in complete()
+  auto* call = new GrpcAsyncSendCall(std::move(callback));
+  call->reader_ = stub->PrepareAsyncSend(&call->context_, message, cq);
+  call->reader_->StartCall();
+  call->reader_->Finish(&call->response_, &call->status_, call);
+}
+
+void GrpcAsyncSendCall::complete(bool ok) {
+  astarte_tl::expected<void, AstarteError> res = {};
+  if (!ok) {
+    res = astarte_tl::unexpected(AstarteGrpcLibError{"Send RPC did not complete"});
+  } else if (!status_.ok()) {
+    spdlog::error("{}: {}", static_cast<int>(status_.error_code()), status_.error_message());
+    res = astarte_tl::unexpected(AstarteGrpcLibError{
+        static_cast<std::uint64_t>(status_.error_code()), status_.error_message()});
+  }
+  callback_(std::move(res));
+  delete this;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -11,11 +11,17 @@
 #include <spdlog/spdlog.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -26,14 +32,17 @@
 #endif
 
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
 #include "astarte_device_sdk/errors.hpp"
 #include "astarte_device_sdk/individual.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/series.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
 #include "grpc_formatter.hpp"  // NOLINT
+#include "interface.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -41,13 +50,6 @@ using std::chrono::duration_cast;
 using std::chrono::nanoseconds;
 using std::chrono::seconds;
 
-using gRPCAstarteBinaryBlobArray = astarteplatform::msghub::AstarteBinaryBlobArray;
-using gRPCAstarteBooleanArray = astarteplatform::msghub::AstarteBooleanArray;
-using gRPCAstarteDateTimeArray = astarteplatform::msghub::AstarteDateTimeArray;
-using gRPCAstarteDoubleArray = astarteplatform::msghub::AstarteDoubleArray;
-using gRPCAstarteIntegerArray = astarteplatform::msghub::AstarteIntegerArray;
-using gRPCAstarteLongIntegerArray = astarteplatform::msghub::AstarteLongIntegerArray;
-using gRPCAstarteStringArray = astarteplatform::msghub::AstarteStringArray;
 using gRPCAstarteData = astarteplatform::msghub::AstarteData;
 using gRPCAstarteDatastreamIndividual = astarteplatform::msghub::AstarteDatastreamIndividual;
 using gRPCAstarteDatastreamObject = astarteplatform::msghub::AstarteDatastreamObject;
@@ -55,235 +57,457 @@ using gRPCAstartePropertyIndividual = astarteplatform::msghub::AstartePropertyIn
 using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
 using gRPCProperty = astarteplatform::msghub::Property;
 
-auto GrpcConverterTo::operator()(int32_t value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting integer to gRPC Astarte data.");
+namespace {
+
+void fill_timestamp(std::chrono::system_clock::time_point value,
+                    google::protobuf::Timestamp* grpc_timestamp) {
+  const std::chrono::system_clock::duration t_duration = value.time_since_epoch();
+  const seconds sec = duration_cast<seconds>(t_duration);
+  const nanoseconds nano = duration_cast<nanoseconds>(t_duration) - sec;
+  grpc_timestamp->set_seconds(static_cast<int64_t>(sec.count()));
+  grpc_timestamp->set_nanos(static_cast<int32_t>(nano.count()));
+}
+
+// Writes a single Astarte data value into an existing gRPC message. Nested messages are created
+// through the mutable accessors, so they are allocated on the same arena as the target message.
+// Repeated fields are cleared before being filled, since a reused message keeps the elements of the
+// previous array while the data case is unchanged. Clearing keeps the allocated capacity.
+struct GrpcDataFiller {
+  gRPCAstarteData* grpc_data;
+
+  void operator()(int32_t value) const {
+    spdlog::trace("Converting integer to gRPC Astarte data.");
+    grpc_data->set_integer(value);
+  }
+  void operator()(int64_t value) const {
+    spdlog::trace("Converting long integer to gRPC Astarte data.");
+    grpc_data->set_long_integer(value);
+  }
+  void operator()(double value) const {
+    spdlog::trace("Converting double to gRPC Astarte data.");
+    grpc_data->set_double_(value);
+  }
+  void operator()(bool value) const {
+    spdlog::trace("Converting boolean to gRPC Astarte data.");
+    grpc_data->set_boolean(value);
+  }
+  void operator()(const std::string& value) const {
+    spdlog::trace("Converting string to gRPC Astarte data.");
+    grpc_data->set_string(value);
+  }
+  void operator()(std::string&& value) const {
+    spdlog::trace("Moving string to gRPC Astarte data.");
+    grpc_data->set_string(std::move(value));
+  }
+  void operator()(const std::vector<uint8_t>& value) const {
+    spdlog::trace("Converting binary blob to gRPC Astarte data.");
+    // Protobuf bytes fields are strings, a single copy of the blob is required
+    grpc_data->mutable_binary_blob()->assign(value.begin(), value.end());
+  }
+  void operator()(std::chrono::system_clock::time_point value) const {
+    spdlog::trace("Converting date-time to gRPC Astarte data.");
+    fill_timestamp(value, grpc_data->mutable_date_time());
+  }
+  void operator()(const std::vector<int32_t>& values) const {
+    spdlog::trace("Converting integer array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_integer_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(const std::vector<int64_t>& values) const {
+    spdlog::trace("Converting long integer array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_long_integer_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(const std::vector<double>& values) const {
+    spdlog::trace("Converting double array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_double_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(const std::vector<bool>& values) const {
+    spdlog::trace("Converting boolean array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_boolean_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const bool value : values) {
+      grpc_values->AddAlreadyReserved(value);
+    }
+  }
+  void operator()(const std::vector<std::string>& values) const {
+    spdlog::trace("Converting string array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_string_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::string& value : values) {
+      grpc_values->Add()->assign(value);
+    }
+  }
+  void operator()(std::vector<std::string>&& values) const {
+    spdlog::trace("Moving string array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_string_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (std::string& value : values) {
+      grpc_values->Add(std::move(value));
+    }
+  }
+  void operator()(const std::vector<std::vector<uint8_t>>& values) const {
+    spdlog::trace("Converting binary blob array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_binary_blob_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::vector<uint8_t>& value : values) {
+      grpc_values->Add()->assign(value.begin(), value.end());
+    }
+  }
+  void operator()(const std::vector<std::chrono::system_clock::time_point>& values) const {
+    spdlog::trace("Converting date-time array to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_date_time_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::chrono::system_clock::time_point& value : values) {
+      // New timestamp in the array, allocated and managed by gRPC
+      fill_timestamp(value, grpc_values->Add());
+    }
+  }
+};
+
+// Writes the content of a non-owning view into an existing gRPC message. Elements are copied
+// straight from the viewed buffer into the repeated fields, cleared first as in GrpcDataFiller.
+struct GrpcDataViewFiller {
+  gRPCAstarteData* grpc_data;
+
+  void operator()(std::span<const uint8_t> value) const {
+    spdlog::trace("Converting binary blob view to gRPC Astarte data.");
+    grpc_data->mutable_binary_blob()->assign(value.begin(), value.end());
+  }
+  void operator()(std::span<const int32_t> values) const {
+    spdlog::trace("Converting integer array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_integer_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(std::span<const int64_t> values) const {
+    spdlog::trace("Converting long integer array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_long_integer_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(std::span<const double> values) const {
+    spdlog::trace("Converting double array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_double_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(std::span<const bool> values) const {
+    spdlog::trace("Converting boolean array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_boolean_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    grpc_values->Add(values.begin(), values.end());
+  }
+  void operator()(std::span<const std::string> values) const {
+    spdlog::trace("Converting string array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_string_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::string& value : values) {
+      grpc_values->Add()->assign(value);
+    }
+  }
+  void operator()(std::span<const std::string_view> values) const {
+    spdlog::trace("Converting string array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_string_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::string_view value : values) {
+      grpc_values->Add()->assign(value);
+    }
+  }
+  void operator()(std::span<const std::vector<uint8_t>> values) const {
+    spdlog::trace("Converting binary blob array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_binary_blob_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::vector<uint8_t>& value : values) {
+      grpc_values->Add()->assign(value.begin(), value.end());
+    }
+  }
+  void operator()(std::span<const std::span<const uint8_t>> values) const {
+    spdlog::trace("Converting binary blob array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_binary_blob_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::span<const uint8_t> value : values) {
+      grpc_values->Add()->assign(value.begin(), value.end());
+    }
+  }
+  void operator()(std::span<const std::chrono::system_clock::time_point> values) const {
+    spdlog::trace("Converting date-time array view to gRPC Astarte data.");
+    auto* grpc_values = grpc_data->mutable_date_time_array()->mutable_values();
+    grpc_values->Clear();
+    grpc_values->Reserve(static_cast<int>(values.size()));
+    for (const std::chrono::system_clock::time_point& value : values) {
+      fill_timestamp(value, grpc_values->Add());
+    }
+  }
+};
+
+template <typename T>
+auto make_grpc_data(const T& value) -> std::unique_ptr<gRPCAstarteData> {
   auto grpc_data = std::make_unique<gRPCAstarteData>();
-  grpc_data->set_integer(value);
+  GrpcDataFiller{grpc_data.get()}(value);
   spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
   return grpc_data;
 }
+
+}  // namespace
+
+auto GrpcConverterTo::operator()(int32_t value) -> std::unique_ptr<gRPCAstarteData> {
+  return make_grpc_data(value);
+}
 auto GrpcConverterTo::operator()(int64_t value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting long integer to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  grpc_data->set_long_integer(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(value);
 }
 auto GrpcConverterTo::operator()(double value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting double to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  grpc_data->set_double_(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(value);
 }
 auto GrpcConverterTo::operator()(bool value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting boolean to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  grpc_data->set_boolean(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(value);
 }
 auto GrpcConverterTo::operator()(const std::string& value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting string to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  grpc_data->set_string(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(value);
 }
 auto GrpcConverterTo::operator()(const std::vector<uint8_t>& value)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting binary blob to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  std::string str_vector(value.begin(), value.end());
-  grpc_data->set_binary_blob(str_vector);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(value);
 }
 auto GrpcConverterTo::operator()(std::chrono::system_clock::time_point value)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting date-time array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  const std::chrono::system_clock::duration t_duration = value.time_since_epoch();
-  const seconds sec = duration_cast<seconds>(t_duration);
-  const nanoseconds nano = duration_cast<nanoseconds>(t_duration) - sec;
-  auto timestamp = std::make_unique<google::protobuf::Timestamp>();
-  timestamp->set_seconds(static_cast<int64_t>(sec.count()));
-  timestamp->set_nanos(static_cast<int32_t>(nano.count()));
-  grpc_data->set_allocated_date_time(timestamp.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(value);
 }
 auto GrpcConverterTo::operator()(const std::vector<int32_t>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting integer array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteIntegerArray>();
-  for (const int32_t& value : values) {
-    grpc_array->add_values(value);
-  }
-  grpc_data->set_allocated_integer_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 auto GrpcConverterTo::operator()(const std::vector<int64_t>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting long integer array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteLongIntegerArray>();
-  for (const int64_t& value : values) {
-    grpc_array->add_values(value);
-  }
-  grpc_data->set_allocated_long_integer_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 auto GrpcConverterTo::operator()(const std::vector<double>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting double array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteDoubleArray>();
-  for (const double& value : values) {
-    grpc_array->add_values(value);
-  }
-  grpc_data->set_allocated_double_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 auto GrpcConverterTo::operator()(const std::vector<bool>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting boolean array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteBooleanArray>();
-  for (const bool& value : values) {
-    grpc_array->add_values(value);
-  }
-  grpc_data->set_allocated_boolean_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 auto GrpcConverterTo::operator()(const std::vector<std::string>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting string array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteStringArray>();
-  for (const std::string& value : values) {
-    grpc_array->add_values(value);
-  }
-  grpc_data->set_allocated_string_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 auto GrpcConverterTo::operator()(const std::vector<std::vector<uint8_t>>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting binary blob array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteBinaryBlobArray>();
-  for (const std::vector<uint8_t>& value : values) {
-    const std::string str_value(value.begin(), value.end());
-    grpc_array->add_values(str_value);
-  }
-  grpc_data->set_allocated_binary_blob_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 auto GrpcConverterTo::operator()(const std::vector<std::chrono::system_clock::time_point>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting date-time array to gRPC Astarte data.");
-  auto grpc_data = std::make_unique<gRPCAstarteData>();
-  auto grpc_array = std::make_unique<gRPCAstarteDateTimeArray>();
-  for (const std::chrono::system_clock::time_point& value : values) {
-    const std::chrono::system_clock::duration t_duration = value.time_since_epoch();
-    const std::chrono::seconds sec = std::chrono::duration_cast<std::chrono::seconds>(t_duration);
-    const std::chrono::nanoseconds nano =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(t_duration) - sec;
-    // New timestamp in the array, allocated and managed by gRPC
-    google::protobuf::Timestamp* timestamp = grpc_array->add_values();
-    timestamp->set_seconds(static_cast<int64_t>(sec.count()));
-    timestamp->set_nanos(static_cast<int32_t>(nano.count()));
-  }
-  grpc_data->set_allocated_date_time_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
-  return grpc_data;
+  return make_grpc_data(values);
 }
 
-// Clang-tidy assumes some of the gRPC calls are memory leaks
-// NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks)
 auto GrpcConverterTo::operator()(const AstarteData& value,
                                  const std::chrono::system_clock::time_point* timestamp)
     -> std::unique_ptr<gRPCAstarteDatastreamIndividual> {
-  spdlog::trace("Converting Astarte datastream individual to gRPC.");
   auto grpc_individual = std::make_unique<gRPCAstarteDatastreamIndividual>();
-
-  if (timestamp != nullptr) {
-    const std::chrono::system_clock::duration t_duration = timestamp->time_since_epoch();
-    const std::chrono::seconds sec = std::chrono::duration_cast<std::chrono::seconds>(t_duration);
-    const std::chrono::nanoseconds nano =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(t_duration) - sec;
-    auto grpc_timestamp = std::make_unique<google::protobuf::Timestamp>();
-    grpc_timestamp->set_seconds(static_cast<int64_t>(sec.count()));
-    grpc_timestamp->set_nanos(static_cast<int32_t>(nano.count()));
-    grpc_individual->set_allocated_timestamp(grpc_timestamp.release());
-  }
-
-  std::unique_ptr<gRPCAstarteData> grpc_data = std::visit(GrpcConverterTo(), value.get_raw_data());
-  grpc_individual->set_allocated_data(grpc_data.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_individual);
+  fill(value, timestamp, grpc_individual.get());
   return grpc_individual;
 }
-// NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 
-// Clang-tidy assumes some of the gRPC calls are memory leaks
-// NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks)
 auto GrpcConverterTo::operator()(const AstarteDatastreamObject& value,
                                  const std::chrono::system_clock::time_point* timestamp)
     -> std::unique_ptr<gRPCAstarteDatastreamObject> {
-  spdlog::trace("Converting Astarte datastream object to gRPC.");
   auto grpc_object = std::make_unique<gRPCAstarteDatastreamObject>();
+  fill(value, timestamp, grpc_object.get());
+  return grpc_object;
+}
+
+auto GrpcConverterTo::operator()(const std::optional<AstarteData>& value)
+    -> std::unique_ptr<gRPCAstartePropertyIndividual> {
+  auto grpc_property = std::make_unique<gRPCAstartePropertyIndividual>();
+  fill(value, grpc_property.get());
+  return grpc_property;
+}
+
+namespace {
+
+// Shared implementation for the copying and moving fill functions. Data is visited in place, while
+// the string payloads of an rvalue are moved into the gRPC message unless shared with a copy. The
+// other types are copied into the message anyway, moving them out first would copy them twice.
+template <typename Data>
+void fill_data(Data&& value, gRPCAstarteData* grpc_data) {
+  if constexpr (std::is_rvalue_reference_v<Data&&>) {
+    switch (value.get_type()) {
+      case kString:
+        GrpcDataFiller{grpc_data}(std::move(value).template into<std::string>());
+        return;
+      case kStringArray:
+        GrpcDataFiller{grpc_data}(std::move(value).template into<std::vector<std::string>>());
+        return;
+      default:
+        break;
+    }
+  }
+  value.visit(GrpcDataFiller{grpc_data});
+}
+
+void fill_data(const AstarteDataView& value, gRPCAstarteData* grpc_data) {
+  std::visit(GrpcDataViewFiller{grpc_data}, value.get_raw_data());
+}
 
+template <typename Data>
+void fill_individual(Data&& value, const std::chrono::system_clock::time_point* timestamp,
+                     gRPCAstarteDatastreamIndividual* grpc_individual) {
+  spdlog::trace("Converting Astarte datastream individual to gRPC.");
   if (timestamp != nullptr) {
-    const std::chrono::system_clock::duration t_duration = timestamp->time_since_epoch();
-    const std::chrono::seconds sec = std::chrono::duration_cast<std::chrono::seconds>(t_duration);
-    const std::chrono::nanoseconds nano =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(t_duration) - sec;
-    auto grpc_timestamp = std::make_unique<google::protobuf::Timestamp>();
-    grpc_timestamp->set_seconds(static_cast<int64_t>(sec.count()));
-    grpc_timestamp->set_nanos(static_cast<int32_t>(nano.count()));
-    grpc_object->set_allocated_timestamp(grpc_timestamp.release());
+    fill_timestamp(*timestamp, grpc_individual->mutable_timestamp());
+  } else {
+    grpc_individual->clear_timestamp();
   }
+  fill_data(std::forward<Data>(value), grpc_individual->mutable_data());
+  spdlog::trace("Resulting gRPC message: \n{}", *grpc_individual);
+}
 
-  google::protobuf::Map<std::string, gRPCAstarteData>* grpc_map = grpc_object->mutable_data();
-  for (const auto& pair : value) {
-    const std::string& path = pair.first;
-    const AstarteData& data = pair.second;
+template <typename Object>
+void fill_object(Object&& value, const std::chrono::system_clock::time_point* timestamp,
+                 gRPCAstarteDatastreamObject* grpc_object) {
+  spdlog::trace("Converting Astarte datastream object to gRPC.");
+  if (timestamp != nullptr) {
+    fill_timestamp(*timestamp, grpc_object->mutable_timestamp());
+  } else {
+    grpc_object->clear_timestamp();
+  }
 
-    const std::unique_ptr<gRPCAstarteData> grpc_data =
-        std::visit(GrpcConverterTo(), data.get_raw_data());
-    // NOTE: It is quite unclear from the protobuffer documentation if this assigment changes
-    // ownership of the pointer. After testing with valgrind it appears that this is not the case.
-    // As a consequence ownership of this grpc_data is not released.
-    (*grpc_map)[path] = *grpc_data;
+  google::protobuf::Map<std::string, gRPCAstarteData>* grpc_map = grpc_object->mutable_data();
+  grpc_map->clear();
+  for (auto&& [path, data] : value) {
+    // Map values are owned by the map and allocated on the arena of the object, if any
+    if constexpr (std::is_rvalue_reference_v<Object&&>) {
+      fill_data(std::move(data), &(*grpc_map)[path]);
+    } else {
+      fill_data(data, &(*grpc_map)[path]);
+    }
   }
   spdlog::trace("Resulting gRPC message: \n{}", *grpc_object);
-  return grpc_object;
 }
-// NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 
-auto GrpcConverterTo::operator()(const std::optional<AstarteData>& value)
-    -> std::unique_ptr<gRPCAstartePropertyIndividual> {
+template <typename OptionalData>
+void fill_property(OptionalData&& value, gRPCAstartePropertyIndividual* grpc_property) {
   spdlog::trace("Converting Astarte property individual to gRPC.");
-  auto grpc_property = std::make_unique<gRPCAstartePropertyIndividual>();
   if (value.has_value()) {
-    const AstarteData& data = value.value();
-    std::unique_ptr<gRPCAstarteData> grpc_data = std::visit(GrpcConverterTo(), data.get_raw_data());
-    grpc_property->set_allocated_data(grpc_data.release());
+    fill_data(std::forward<OptionalData>(value).value(), grpc_property->mutable_data());
+  } else {
+    grpc_property->clear_data();
   }
   spdlog::trace("Resulting gRPC message: \n{}", *grpc_property);
-  return grpc_property;
 }
 
+}  // namespace
+
+void GrpcConverterTo::fill(const AstarteData& value, gRPCAstarteData* grpc_data) {
+  fill_data(value, grpc_data);
+}
+
+void GrpcConverterTo::fill(AstarteData&& value, gRPCAstarteData* grpc_data) {
+  fill_data(std::move(value), grpc_data);
+}
+
+void GrpcConverterTo::fill(const AstarteData& value,
+                           const std::chrono::system_clock::time_point* timestamp,
+                           gRPCAstarteDatastreamIndividual* grpc_individual) {
+  fill_individual(value, timestamp, grpc_individual);
+}
+
+void GrpcConverterTo::fill(AstarteData&& value,
+                           const std::chrono::system_clock::time_point* timestamp,
+                           gRPCAstarteDatastreamIndividual* grpc_individual) {
+  fill_individual(std::move(value), timestamp, grpc_individual);
+}
+
+void GrpcConverterTo::fill(const AstarteDataView& value, gRPCAstarteData* grpc_data) {
+  fill_data(value, grpc_data);
+}
+
+void GrpcConverterTo::fill(const AstarteDataView& value,
+                           const std::chrono::system_clock::time_point* timestamp,
+                           gRPCAstarteDatastreamIndividual* grpc_individual) {
+  fill_individual(value, timestamp, grpc_individual);
+}
+
+void GrpcConverterTo::fill(const AstarteDatastreamObject& value,
+                           const std::chrono::system_clock::time_point* timestamp,
+                           gRPCAstarteDatastreamObject* grpc_object) {
+  fill_object(value, timestamp, grpc_object);
+}
+
+void GrpcConverterTo::fill(AstarteDatastreamObject&& value,
+                           const std::chrono::system_clock::time_point* timestamp,
+                           gRPCAstarteDatastreamObject* grpc_object) {
+  fill_object(std::move(value), timestamp, grpc_object);
+}
+
+void GrpcConverterTo::fill(const AstarteDatastreamSeries& series, std::size_t index,
+                           gRPCAstarteDatastreamIndividual* grpc_individual) {
+  fill_timestamp(series.get_timestamps()[index], grpc_individual->mutable_timestamp());
+  // The sample is written directly from the vector of the series, without an intermediate data
+  std::visit(
+      [index, grpc_individual](const auto& values) {
+        const GrpcDataFiller filler{grpc_individual->mutable_data()};
+        if constexpr (std::is_same_v<std::decay_t<decltype(values)>, std::vector<bool>>) {
+          // Elements of vector<bool> are proxies, convert them back to a boolean
+          filler(static_cast<bool>(values[index]));
+        } else {
+          filler(values[index]);
+        }
+      },
+      series.get_raw_data());
+}
+
+void GrpcConverterTo::fill(const std::optional<AstarteData>& value,
+                           gRPCAstartePropertyIndividual* grpc_property) {
+  fill_property(value, grpc_property);
+}
+
+void GrpcConverterTo::fill(std::optional<AstarteData>&& value,
+                           gRPCAstartePropertyIndividual* grpc_property) {
+  fill_property(std::move(value), grpc_property);
+}
+
+namespace {
+
+auto to_time_point(const google::protobuf::Timestamp& timestamp)
+    -> std::chrono::system_clock::time_point {
+  auto secs = std::chrono::seconds{timestamp.seconds()};
+  auto nanos = std::chrono::nanoseconds{timestamp.nanos()};
+  auto duration = std::chrono::duration_cast<std::chrono::system_clock::duration>(secs + nanos);
+  return std::chrono::system_clock::time_point(duration);
+}
+
+// True when the gRPC message is passed as an rvalue and its payloads can be moved out of it.
+// The strings of arena allocated messages own a heap buffer, so they can be moved as well.
+template <typename Message>
+constexpr bool is_consumed_v = !std::is_const_v<std::remove_reference_t<Message>>;
+
 // NOLINTBEGIN(readability-function-size)
-auto GrpcConverterFrom::operator()(const gRPCAstarteData& value)
-    -> astarte_tl::expected<AstarteData, AstarteError> {
+template <typename GrpcData>
+auto convert_data(GrpcData&& value) -> astarte_tl::expected<AstarteData, AstarteError> {
   spdlog::trace("Converting Astarte data from gRPC, message: \n{}", value);
   switch (value.astarte_data_case()) {
     case gRPCAstarteData::kDouble:
@@ -300,20 +524,18 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value)
       return AstarteData(value.long_integer());
     case gRPCAstarteData::kString:
       spdlog::trace("Case kString");
-      return AstarteData(value.string());
+      if constexpr (is_consumed_v<GrpcData>) {
+        return AstarteData(std::move(*value.mutable_string()));
+      } else {
+        return AstarteData(value.string());
+      }
     case gRPCAstarteData::kBinaryBlob:
       spdlog::trace("Case kBinaryBlob");
       return AstarteData(
           std::vector<uint8_t>(value.binary_blob().begin(), value.binary_blob().end()));
-    case gRPCAstarteData::kDateTime: {
+    case gRPCAstarteData::kDateTime:
       spdlog::trace("Case kDateTime");
-      const google::protobuf::Timestamp& timestamp = value.date_time();
-      auto secs = std::chrono::seconds{timestamp.seconds()};
-      auto nanos = std::chrono::nanoseconds{timestamp.nanos()};
-      auto duration = std::chrono::duration_cast<std::chrono::system_clock::duration>(secs + nanos);
-      const std::chrono::system_clock::time_point timepoint(duration);
-      return AstarteData(timepoint);
-    }
+      return AstarteData(to_time_point(value.date_time()));
     case gRPCAstarteData::kDoubleArray:
       spdlog::trace("Case kDoubleArray");
       return AstarteData(std::vector<double>(value.double_array().values().begin(),
@@ -332,27 +554,31 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value)
                                               value.long_integer_array().values().end()));
     case gRPCAstarteData::kStringArray:
       spdlog::trace("Case kStringArray");
-      return AstarteData(std::vector<std::string>(value.string_array().values().begin(),
-                                                  value.string_array().values().end()));
+      if constexpr (is_consumed_v<GrpcData>) {
+        auto* values = value.mutable_string_array()->mutable_values();
+        return AstarteData(std::vector<std::string>(std::make_move_iterator(values->begin()),
+                                                    std::make_move_iterator(values->end())));
+      } else {
+        return AstarteData(std::vector<std::string>(value.string_array().values().begin(),
+                                                    value.string_array().values().end()));
+      }
     case gRPCAstarteData::kBinaryBlobArray: {
       spdlog::trace("Case kBinaryBlobArray");
       std::vector<std::vector<uint8_t>> binblob_vect;
+      binblob_vect.reserve(value.binary_blob_array().values_size());
       for (const auto& str : value.binary_blob_array().values()) {
         binblob_vect.emplace_back(str.begin(), str.end());
       }
-      return AstarteData(binblob_vect);
+      return AstarteData(std::move(binblob_vect));
     }
     case gRPCAstarteData::kDateTimeArray: {
       spdlog::trace("Case kDateTimeArray");
       std::vector<std::chrono::system_clock::time_point> timestamp_vect;
+      timestamp_vect.reserve(value.date_time_array().values_size());
       for (const auto& timestamp : value.date_time_array().values()) {
-        auto secs = std::chrono::seconds{timestamp.seconds()};
-        auto nanos = std::chrono::nanoseconds{timestamp.nanos()};
-        auto duration =
-            std::chrono::duration_cast<std::chrono::system_clock::duration>(secs + nanos);
-        timestamp_vect.emplace_back(duration);
+        timestamp_vect.push_back(to_time_point(timestamp));
       }
-      return AstarteData(timestamp_vect);
+      return AstarteData(std::move(timestamp_vect));
     }
     default:
       spdlog::trace("Case for gRPCAstarteData goes to default statement: ASTARTE_DATA_NOT_SET");
@@ -363,65 +589,174 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value)
 }
 // NOLINTEND(readability-function-size)
 
-auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamIndividual& value)
+template <typename GrpcIndividual>
+auto convert_individual(GrpcIndividual&& value)
     -> astarte_tl::expected<AstarteDatastreamIndividual, AstarteError> {
   spdlog::trace("Converting Astarte datastream individual from gRPC, message: \n{}", value);
-  const gRPCAstarteData& grpc_data(value.data());
-  return (*this)(grpc_data).transform(
-      [](const AstarteData& data) { return AstarteDatastreamIndividual(data); });
+  if constexpr (is_consumed_v<GrpcIndividual>) {
+    return convert_data(std::move(*value.mutable_data())).transform([](AstarteData&& data) {
+      return AstarteDatastreamIndividual(std::move(data));
+    });
+  } else {
+    return convert_data(value.data()).transform(
+        [](const AstarteData& data) { return AstarteDatastreamIndividual(data); });
+  }
 }
 
-auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamObject& value)
+template <typename GrpcObject>
+auto convert_object(GrpcObject&& value)
     -> astarte_tl::expected<AstarteDatastreamObject, AstarteError> {
   spdlog::trace("Converting Astarte datastream object from gRPC, message: \n{}", value);
   AstarteDatastreamObject object;
-  const google::protobuf::Map<std::string, gRPCAstarteData>& grpc_data = value.data();
-  for (const auto& [key, data] : grpc_data) {
-    auto converted_data = (*this)(data);
+  // The keys of a protobuf map are immutable, only the values can be moved
+  auto& grpc_data = [&]() -> auto& {
+    if constexpr (is_consumed_v<GrpcObject>) {
+      return *value.mutable_data();
+    } else {
+      return value.data();
+    }
+  }();
+  object.reserve(static_cast<AstarteDatastreamObject::size_type>(grpc_data.size()));
+  for (auto& [key, data] : grpc_data) {
+    auto converted_data = [&]() {
+      if constexpr (is_consumed_v<GrpcObject>) {
+        return convert_data(std::move(data));
+      } else {
+        return convert_data(data);
+      }
+    }();
     if (!converted_data) {
       return astarte_tl::unexpected(converted_data.error());
     }
-    object.insert(key, converted_data.value());
+    object.insert(std::string(key), std::move(converted_data.value()));
   }
   return object;
 }
 
-auto GrpcConverterFrom::operator()(const gRPCAstartePropertyIndividual& value)
+template <typename GrpcProperty>
+auto convert_property(GrpcProperty&& value)
     -> astarte_tl::expected<AstartePropertyIndividual, AstarteError> {
   spdlog::trace("Converting Astarte property individual from gRPC, message: \n{}", value);
-  if (value.has_data()) {
-    const gRPCAstarteData& grpc_data(value.data());
-    return (*this)(grpc_data).transform(
+  if (!value.has_data()) {
+    return AstartePropertyIndividual(std::nullopt);
+  }
+  if constexpr (is_consumed_v<GrpcProperty>) {
+    return convert_data(std::move(*value.mutable_data())).transform([](AstarteData&& data) {
+      return AstartePropertyIndividual(std::move(data));
+    });
+  } else {
+    return convert_data(value.data()).transform(
         [](const AstarteData& data) { return AstartePropertyIndividual(data); });
   }
-  return AstartePropertyIndividual(std::nullopt);
 }
 
-auto GrpcConverterFrom::operator()(const gRPCAstarteMessage& value)
+// The message shares the name and paths of the interface, when known
+template <typename GrpcMessage>
+auto convert_message(GrpcMessage&& value, const AstarteInterface* interface = nullptr)
     -> astarte_tl::expected<AstarteMessage, AstarteError> {
   spdlog::trace("Converting Astarte message from gRPC, message: \n{}", value);
 
   auto make_message = [&](auto&& val) {
-    const std::variant<AstarteDatastreamIndividual, AstarteDatastreamObject,
-                       AstartePropertyIndividual>
+    std::variant<AstarteDatastreamIndividual, AstarteDatastreamObject, AstartePropertyIndividual>
         parsed_data(std::forward<decltype(val)>(val));
-    return AstarteMessage{value.interface_name(), value.path(), parsed_data};
+    if constexpr (is_consumed_v<GrpcMessage>) {
+      if (interface != nullptr) {
+        return AstarteMessage{interface->name_handle(),
+                              interface->path_handle(std::move(*value.mutable_path())),
+                              std::move(parsed_data)};
+      }
+      return AstarteMessage{std::move(*value.mutable_interface_name()),
+                            std::move(*value.mutable_path()), std::move(parsed_data)};
+    } else {
+      return AstarteMessage{value.interface_name(), value.path(), std::move(parsed_data)};
+    }
   };
 
-  if (value.has_datastream_individual()) {
-    return (*this)(value.datastream_individual()).transform(make_message);
-  }
-  if (value.has_datastream_object()) {
-    return (*this)(value.datastream_object()).transform(make_message);
-  }
-  if (value.has_property_individual()) {
-    return (*this)(value.property_individual()).transform(make_message);
+  if constexpr (is_consumed_v<GrpcMessage>) {
+    if (value.has_datastream_individual()) {
+      return convert_individual(std::move(*value.mutable_datastream_individual()))
+          .transform(make_message);
+    }
+    if (value.has_datastream_object()) {
+      return convert_object(std::move(*value.mutable_datastream_object())).transform(make_message);
+    }
+    if (value.has_property_individual()) {
+      return convert_property(std::move(*value.mutable_property_individual()))
+          .transform(make_message);
+    }
+  } else {
+    if (value.has_datastream_individual()) {
+      return convert_individual(value.datastream_individual()).transform(make_message);
+    }
+    if (value.has_datastream_object()) {
+      return convert_object(value.datastream_object()).transform(make_message);
+    }
+    if (value.has_property_individual()) {
+      return convert_property(value.property_individual()).transform(make_message);
+    }
   }
 
   return astarte_tl::unexpected(
       AstarteInternalError{"Found an unrecognized gRPC gRPCAstarteDataType."});
 }
 
+}  // namespace
+
+auto GrpcConverterFrom::operator()(const gRPCAstarteData& value)
+    -> astarte_tl::expected<AstarteData, AstarteError> {
+  return convert_data(value);
+}
+
+auto GrpcConverterFrom::operator()(gRPCAstarteData&& value)
+    -> astarte_tl::expected<AstarteData, AstarteError> {
+  return convert_data(std::move(value));
+}
+
+auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamIndividual& value)
+    -> astarte_tl::expected<AstarteDatastreamIndividual, AstarteError> {
+  return convert_individual(value);
+}
+
+auto GrpcConverterFrom::operator()(gRPCAstarteDatastreamIndividual&& value)
+    -> astarte_tl::expected<AstarteDatastreamIndividual, AstarteError> {
+  return convert_individual(std::move(value));
+}
+
+auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamObject& value)
+    -> astarte_tl::expected<AstarteDatastreamObject, AstarteError> {
+  return convert_object(value);
+}
+
+auto GrpcConverterFrom::operator()(gRPCAstarteDatastreamObject&& value)
+    -> astarte_tl::expected<AstarteDatastreamObject, AstarteError> {
+  return convert_object(std::move(value));
+}
+
+auto GrpcConverterFrom::operator()(const gRPCAstartePropertyIndividual& value)
+    -> astarte_tl::expected<AstartePropertyIndividual, AstarteError> {
+  return convert_property(value);
+}
+
+auto GrpcConverterFrom::operator()(gRPCAstartePropertyIndividual&& value)
+    -> astarte_tl::expected<AstartePropertyIndividual, AstarteError> {
+  return convert_property(std::move(value));
+}
+
+auto GrpcConverterFrom::operator()(const gRPCAstarteMessage& value)
+    -> astarte_tl::expected<AstarteMessage, AstarteError> {
+  return convert_message(value);
+}
+
+auto GrpcConverterFrom::operator()(gRPCAstarteMessage&& value)
+    -> astarte_tl::expected<AstarteMessage, AstarteError> {
+  return convert_message(std::move(value));
+}
+
+auto GrpcConverterFrom::operator()(gRPCAstarteMessage&& value, const AstarteInterface& interface)
+    -> astarte_tl::expected<AstarteMessage, AstarteError> {
+  return convert_message(std::move(value), &interface);
+}
+
 auto GrpcConverterFrom::operator()(const gRPCOwnership& value) -> AstarteOwnership {
   spdlog::trace("Converting Astarte ownership from gRPC.");
   return (value == gRPCOwnership::DEVICE) ? AstarteOwnership::kDevice : AstarteOwnership::kServer;
@@ -0,0 +1,321 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "interface.hpp"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/interned_string.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+auto parse_type(std::string_view type) -> std::optional<AstarteType> {
+  static constexpr std::array<std::pair<std::string_view, AstarteType>, 14> types = {{
+      {"binaryblob", AstarteType::kBinaryBlob},
+      {"boolean", AstarteType::kBoolean},
+      {"datetime", AstarteType::kDatetime},
+      {"double", AstarteType::kDouble},
+      {"integer", AstarteType::kInteger},
+      {"longinteger", AstarteType::kLongInteger},
+      {"string", AstarteType::kString},
+      {"binaryblobarray", AstarteType::kBinaryBlobArray},
+      {"booleanarray", AstarteType::kBooleanArray},
+      {"datetimearray", AstarteType::kDatetimeArray},
+      {"doublearray", AstarteType::kDoubleArray},
+      {"integerarray", AstarteType::kIntegerArray},
+      {"longintegerarray", AstarteType::kLongIntegerArray},
+      {"stringarray", AstarteType::kStringArray}}};
+  for (const auto& [name, value] : types) {
+    if (name == type) {
+      return value;
+    }
+  }
+  return std::nullopt;
+}
+
+auto parse_retention(std::string_view retention) -> std::optional<AstarteRetention> {
+  if (retention == "discard") {
+    return AstarteRetention::kDiscard;
+  }
+  if (retention == "volatile") {
+    return AstarteRetention::kVolatile;
+  }
+  if (retention == "stored") {
+    return AstarteRetention::kStored;
+  }
+  return std::nullopt;
+}
+
+auto is_parameter(std::string_view segment) -> bool {
+  return segment.starts_with("%{") && segment.ends_with("}");
+}
+
+// Split the first segment from a path starting with '/', returning false if the path is malformed
+auto next_segment(std::string_view& path, std::string_view& segment) -> bool {
+  if (path.empty() || (path.front() != '/')) {
+    return false;
+  }
+  path.remove_prefix(1);
+  const std::size_t segment_len = std::min(path.find('/'), path.size());
+  segment = path.substr(0, segment_len);
+  path.remove_prefix(segment_len);
+  return !segment.empty();
+}
+
+// Match a path against an endpoint, segment by segment. Parameters match any non empty segment.
+auto endpoint_matches(std::string_view endpoint, std::string_view path) -> bool {
+  while (!endpoint.empty() && !path.empty()) {
+    if ((endpoint.front() != '/') || (path.front() != '/')) {
+      return false;
+    }
+    endpoint.remove_prefix(1);
+    path.remove_prefix(1);
+    const std::size_t endpoint_seg_len = std::min(endpoint.find('/'), endpoint.size());
+    const std::size_t path_seg_len = std::min(path.find('/'), path.size());
+    const std::string_view endpoint_seg = endpoint.substr(0, endpoint_seg_len);
+    const std::string_view path_seg = path.substr(0, path_seg_len);
+    if ((path_seg.empty()) || (!is_parameter(endpoint_seg) && (endpoint_seg != path_seg))) {
+      return false;
+    }
+    endpoint.remove_prefix(endpoint_seg_len);
+    path.remove_prefix(path_seg_len);
+  }
+  return endpoint.empty() && path.empty();
+}
+
+auto invalid_interface(std::string_view reason) -> AstarteError {
+  spdlog::error("Invalid interface: {}", reason);
+  return AstarteInvalidInputError{"Invalid interface: " + std::string(reason)};
+}
+
+}  // namespace
+
+auto AstarteMapping::matches(std::string_view path) const -> bool {
+  return endpoint_matches(endpoint, path);
+}
+
+auto AstarteInterface::create(std::string_view json)
+    -> astarte_tl::expected<AstarteInterface, AstarteError> {
+  const nlohmann::json parsed = nlohmann::json::parse(json, nullptr, false);
+  if (parsed.is_discarded() || !parsed.is_object()) {
+    return astarte_tl::unexpected(invalid_interface("malformed JSON"));
+  }
+
+  AstarteInterface interface;
+  try {
+    interface.name_ = parsed.at("interface_name").get<std::string>();
+    interface.version_major_ = parsed.at("version_major").get<int32_t>();
+    interface.version_minor_ = parsed.at("version_minor").get<int32_t>();
+
+    const auto type = parsed.at("type").get<std::string>();
+    if (type == "datastream") {
+      interface.type_ = AstarteInterfaceType::kDatastream;
+    } else if (type == "properties") {
+      interface.type_ = AstarteInterfaceType::kProperties;
+    } else {
+      return astarte_tl::unexpected(invalid_interface("unknown type " + type));
+    }
+
+    const auto ownership = parsed.at("ownership").get<std::string>();
+    if (ownership == ownership_as_str(AstarteOwnership::kDevice)) {
+      interface.ownership_ = AstarteOwnership::kDevice;
+    } else if (ownership == ownership_as_str(AstarteOwnership::kServer)) {
+      interface.ownership_ = AstarteOwnership::kServer;
+    } else {
+      return astarte_tl::unexpected(invalid_interface("unknown ownership " + ownership));
+    }
+
+    const auto aggregation = parsed.value("aggregation", std::string("individual"));
+    if (aggregation == "individual") {
+      interface.aggregation_ = AstarteAggregation::kIndividual;
+    } else if (aggregation == "object") {
+      interface.aggregation_ = AstarteAggregation::kObject;
+    } else {
+      return astarte_tl::unexpected(invalid_interface("unknown aggregation " + aggregation));
+    }
+
+    for (const auto& mapping : parsed.at("mappings")) {
+      const auto endpoint = mapping.at("endpoint").get<std::string>();
+      const auto mapping_type = parse_type(mapping.at("type").get<std::string>());
+      if (!mapping_type) {
+        return astarte_tl::unexpected(invalid_interface("unknown type for " + endpoint));
+      }
+      const auto retention = parse_retention(mapping.value("retention", std::string("discard")));
+      if (!retention) {
+        return astarte_tl::unexpected(invalid_interface("unknown retention for " + endpoint));
+      }
+      const auto expiry = std::chrono::seconds(mapping.value("expiry", int64_t{0}));
+      const bool explicit_timestamp = mapping.value("explicit_timestamp", false);
+      interface.mappings_.push_back(AstarteMapping{.endpoint = endpoint,
+                                                   .type = mapping_type.value(),
+                                                   .retention = retention.value(),
+                                                   .expiry = expiry,
+                                                   .explicit_timestamp = explicit_timestamp});
+    }
+  } catch (const nlohmann::json::exception& err) {
+    return astarte_tl::unexpected(invalid_interface(err.what()));
+  }
+
+  if (interface.mappings_.empty()) {
+    return astarte_tl::unexpected(invalid_interface("no mappings for " + interface.name_));
+  }
+  interface.build_index();
+  interface.build_shared_names();
+  return interface;
+}
+
+auto AstarteInterface::parse_name(std::string_view json) -> std::optional<std::string> {
+  const nlohmann::json parsed = nlohmann::json::parse(json, nullptr, false);
+  if (parsed.is_discarded() || !parsed.is_object()) {
+    return std::nullopt;
+  }
+  auto iter = parsed.find("interface_name");
+  if ((iter == parsed.end()) || !iter->is_string()) {
+    return std::nullopt;
+  }
+  return iter->get<std::string>();
+}
+
+auto AstarteInterface::name() const -> const std::string& { return name_; }
+
+auto AstarteInterface::version_major() const -> int32_t { return version_major_; }
+
+auto AstarteInterface::version_minor() const -> int32_t { return version_minor_; }
+
+auto AstarteInterface::type() const -> AstarteInterfaceType { return type_; }
+
+auto AstarteInterface::ownership() const -> AstarteOwnership { return ownership_; }
+
+auto AstarteInterface::aggregation() const -> AstarteAggregation { return aggregation_; }
+
+auto AstarteInterface::mappings() const -> const std::vector<AstarteMapping>& { return mappings_; }
+
+auto AstarteInterface::find_mapping(std::string_view path) const -> const AstarteMapping* {
+  const MappingNode* node = find_node(path);
+  if ((node == nullptr) || !node->mapping) {
+    return nullptr;
+  }
+  return &mappings_[node->mapping.value()];
+}
+
+auto AstarteInterface::find_object_field(std::string_view path, std::string_view field) const
+    -> const AstarteMapping* {
+  const MappingNode* node = find_node(path);
+  if (node == nullptr) {
+    return nullptr;
+  }
+  auto iter = node->fields.find(field);
+  return (iter != node->fields.end()) ? &mappings_[iter->second] : nullptr;
+}
+
+void AstarteInterface::build_index() {
+  auto root = std::make_shared<MappingNode>();
+  for (std::size_t i = 0; i < mappings_.size(); ++i) {
+    std::string_view endpoint(mappings_[i].endpoint);
+    // The object path is the endpoint without its last segment, the field name
+    std::string_view field;
+    if (aggregation_ == AstarteAggregation::kObject) {
+      const std::size_t last = endpoint.rfind('/');
+      field = endpoint.substr(last + 1);
+      endpoint = endpoint.substr(0, last);
+    }
+    MappingNode* node = root.get();
+    std::string_view segment;
+    while (next_segment(endpoint, segment)) {
+      if (is_parameter(segment)) {
+        if (!node->parameter) {
+          node->parameter = std::make_unique<MappingNode>();
+        }
+        node = node->parameter.get();
+      } else {
+        node = &node->children.try_emplace(std::string(segment)).first->second;
+      }
+    }
+    if (!node->mapping) {
+      node->mapping = i;
+    }
+    if (aggregation_ == AstarteAggregation::kObject) {
+      node->fields.try_emplace(std::string(field), i);
+    }
+  }
+  index_ = std::move(root);
+}
+
+auto AstarteInterface::find_node(std::string_view path) const -> const MappingNode* {
+  if (!index_) {
+    return nullptr;
+  }
+  // Literal segments take precedence over parameters, backtracking when they lead nowhere
+  auto match = [](auto& self, const MappingNode& node,
+                  std::string_view rest) -> const MappingNode* {
+    if (rest.empty()) {
+      return node.mapping ? &node : nullptr;
+    }
+    std::string_view segment;
+    if (!next_segment(rest, segment)) {
+      return nullptr;
+    }
+    if (auto child = node.children.find(segment); child != node.children.end()) {
+      if (const MappingNode* found = self(self, child->second, rest)) {
+        return found;
+      }
+    }
+    return node.parameter ? self(self, *node.parameter, rest) : nullptr;
+  };
+  return match(match, *index_, path);
+}
+
+auto AstarteInterface::name_handle() const -> AstarteInternedString {
+  return AstarteInternedString(shared_names_->name);
+}
+
+auto AstarteInterface::path_handle(std::string&& path) const -> AstarteInternedString {
+  auto iter = shared_names_->paths.find(path);
+  if (iter != shared_names_->paths.end()) {
+    return AstarteInternedString(iter->second);
+  }
+  return AstarteInternedString(std::move(path));
+}
+
+void AstarteInterface::build_shared_names() {
+  auto names = std::make_shared<SharedNames>();
+  names->name = std::make_shared<const std::string>(name_);
+  for (const auto& mapping : mappings_) {
+    std::string_view path(mapping.endpoint);
+    if (aggregation_ == AstarteAggregation::kObject) {
+      path = path.substr(0, path.rfind('/'));
+    }
+    // Parametric paths take a different value for each message and are not shared
+    if ((path.find("%{") == std::string_view::npos) && !names->paths.contains(path)) {
+      names->paths.emplace(path, std::make_shared<const std::string>(path));
+    }
+  }
+  shared_names_ = std::move(names);
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,20 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/interned_string.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace AstarteDeviceSdk {
+
+AstarteInternedString::AstarteInternedString(std::string_view str)
+    : str_(std::make_shared<const std::string>(str)) {}
+
+AstarteInternedString::AstarteInternedString(std::string&& str)
+    : str_(std::make_shared<const std::string>(std::move(str))) {}
+
+}  // namespace AstarteDeviceSdk
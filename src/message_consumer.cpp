@@ -0,0 +1,53 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/message_consumer.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/msg.hpp"
+#include "message_consumer_impl.hpp"
+#include "multicast_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+AstarteMessageConsumer::AstarteMessageConsumerImpl::AstarteMessageConsumerImpl(
+    std::shared_ptr<MulticastQueue<AstarteMessage>::Subscriber> queue)
+    : queue(std::move(queue)) {}
+
+AstarteMessageConsumer::AstarteMessageConsumerImpl::~AstarteMessageConsumerImpl() {
+  // The reception thread might hold a reference to the queue while blocked on it
+  std::vector<std::shared_ptr<const AstarteMessage>> discarded;
+  while (queue->pop_batch(discarded, queue->size() + 1, std::chrono::milliseconds(0)) != 0) {
+    discarded.clear();
+  }
+}
+
+AstarteMessageConsumer::AstarteMessageConsumer(std::shared_ptr<AstarteMessageConsumerImpl> impl)
+    : message_consumer_impl_(std::move(impl)) {}
+
+auto AstarteMessageConsumer::poll(const std::chrono::milliseconds& timeout)
+    -> std::shared_ptr<const AstarteMessage> {
+  std::optional<std::shared_ptr<const AstarteMessage>> message =
+      message_consumer_impl_->queue->pop(timeout);
+  return message ? std::move(message.value()) : nullptr;
+}
+
+auto AstarteMessageConsumer::poll_batch(std::vector<std::shared_ptr<const AstarteMessage>>& out,
+                                        std::size_t max, std::chrono::milliseconds timeout)
+    -> std::size_t {
+  return message_consumer_impl_->queue->pop_batch(out, max, timeout);
+}
+
+auto AstarteMessageConsumer::get_dropped_messages() -> std::uint64_t {
+  return message_consumer_impl_->queue->dropped();
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,68 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "message_dispatcher.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+#include "astarte_device_sdk/message_handler.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "blocking_queue.hpp"
+
+namespace AstarteDeviceSdk {
+
+MessageDispatcher::MessageDispatcher(BlockingQueue<AstarteMessage>& queue,
+                                     AstarteMessageHandler handler, std::size_t workers)
+    : queue_(queue), handler_(std::move(handler)) {
+  workers_.reserve(workers);
+  for (std::size_t i = 0; i < workers; ++i) {
+    workers_.emplace_back([this](const std::stop_token& token) { this->worker_loop(token); });
+  }
+}
+
+MessageDispatcher::~MessageDispatcher() {
+  // Stop all the workers at once, jthread's destructor will then join them
+  request_stop();
+}
+
+void MessageDispatcher::request_stop() {
+  for (auto& worker : workers_) {
+    worker.request_stop();
+  }
+}
+
+auto MessageDispatcher::runs_on_current_thread() const -> bool {
+  const std::thread::id current = std::this_thread::get_id();
+  return std::any_of(workers_.begin(), workers_.end(),
+                     [current](const std::jthread& worker) { return worker.get_id() == current; });
+}
+
+void MessageDispatcher::worker_loop(const std::stop_token& token) {
+  spdlog::debug("Message dispatcher worker has been started");
+  while (!token.stop_requested()) {
+    std::optional<AstarteMessage> message =
+        queue_.pop(std::chrono::milliseconds(idle_interval_ms));
+    if (!message) {
+      continue;
+    }
+    try {
+      handler_(message.value());
+    } catch (const std::exception& err) {
+      spdlog::error("Message handler failed for {} {}: {}", message->get_interface(),
+                    message->get_path(), err.what());
+    }
+  }
+  spdlog::debug("Message dispatcher worker has been terminated");
+}
+
+}  // namespace AstarteDeviceSdk
@@ -8,14 +8,21 @@
 #include <variant>
 
 #include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/interned_string.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/property.hpp"
 
 namespace AstarteDeviceSdk {
 
-auto AstarteMessage::get_interface() const -> const std::string& { return interface_; }
+auto AstarteMessage::get_interface() const -> const std::string& { return interface_.get(); }
 
-auto AstarteMessage::get_path() const -> const std::string& { return path_; }
+auto AstarteMessage::get_path() const -> const std::string& { return path_.get(); }
+
+auto AstarteMessage::get_interface_handle() const -> const AstarteInternedString& {
+  return interface_;
+}
+
+auto AstarteMessage::get_path_handle() const -> const AstarteInternedString& { return path_; }
 
 auto AstarteMessage::is_datastream() const -> bool {
   return std::holds_alternative<AstarteDatastreamIndividual>(data_) ||
@@ -33,11 +40,11 @@ auto AstarteMessage::get_raw_data() const -> const
 }
 
 auto AstarteMessage::operator==(const AstarteMessage& other) const -> bool {
-  return this->interface_ == other.get_interface() && this->path_ == other.get_path() &&
+  return this->interface_ == other.interface_ && this->path_ == other.path_ &&
          this->data_ == other.get_raw_data();
 }
 auto AstarteMessage::operator!=(const AstarteMessage& other) const -> bool {
-  return this->interface_ != other.get_interface() || this->path_ != other.get_path() ||
+  return this->interface_ != other.interface_ || this->path_ != other.path_ ||
          this->data_ != other.get_raw_data();
 }
 
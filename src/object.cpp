@@ -4,8 +4,12 @@
 
 #include "astarte_device_sdk/object.hpp"
 
+#include <algorithm>
 #include <initializer_list>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "astarte_device_sdk/data.hpp"
 
@@ -13,42 +17,106 @@ namespace AstarteDeviceSdk {
 
 // Default constructor
 AstarteDatastreamObject::AstarteDatastreamObject() = default;
-// Constructor with initializer list
-AstarteDatastreamObject::AstarteDatastreamObject(std::initializer_list<MapType::value_type> init)
-    : data_(init) {}
+// Constructor with initializer list, the first occurrence of a duplicated key is kept
+AstarteDatastreamObject::AstarteDatastreamObject(std::initializer_list<value_type> init) {
+  data_.reserve(init.size());
+  for (const auto& [key, data] : init) {
+    insert_sorted(key, data);
+  }
+}
 // Access element by key (modifiable)
-auto AstarteDatastreamObject::at(const std::string& key) -> AstarteData& { return data_.at(key); }
+auto AstarteDatastreamObject::at(std::string_view key) -> AstarteData& {
+  auto iter = find_element(key);
+  if (iter == data_.end()) {
+    throw std::out_of_range("Missing object path: " + std::string(key));
+  }
+  return iter->second;
+}
 // Access element by key (const)
-auto AstarteDatastreamObject::at(const std::string& key) const -> const AstarteData& {
-  return data_.at(key);
+auto AstarteDatastreamObject::at(std::string_view key) const -> const AstarteData& {
+  auto iter = find_element(key);
+  if (iter == data_.end()) {
+    throw std::out_of_range("Missing object path: " + std::string(key));
+  }
+  return iter->second;
 }
 // Begin iterator (modifiable)
-auto AstarteDatastreamObject::begin() -> iterator { return data_.begin(); }
+auto AstarteDatastreamObject::begin() -> iterator { return iterator(data_.begin()); }
 // Begin iterator (const)
-auto AstarteDatastreamObject::begin() const -> const_iterator { return data_.begin(); }
+auto AstarteDatastreamObject::begin() const -> const_iterator {
+  return const_iterator(data_.begin());
+}
 // End iterator (modifiable)
-auto AstarteDatastreamObject::end() -> iterator { return data_.end(); }
+auto AstarteDatastreamObject::end() -> iterator { return iterator(data_.end()); }
 // End iterator (const)
-auto AstarteDatastreamObject::end() const -> const_iterator { return data_.end(); }
+auto AstarteDatastreamObject::end() const -> const_iterator { return const_iterator(data_.end()); }
 // Get size of the map
 auto AstarteDatastreamObject::size() const -> size_type { return data_.size(); }
 // Check if map is empty
 auto AstarteDatastreamObject::empty() const -> bool { return data_.empty(); }
+// Reserve storage for the elements
+void AstarteDatastreamObject::reserve(size_type count) { data_.reserve(count); }
+// Check if the map contains a key
+auto AstarteDatastreamObject::contains(std::string_view key) const -> bool {
+  return find_element(key) != data_.end();
+}
 // Insert element into the map
 void AstarteDatastreamObject::insert(const std::string& key, const AstarteData& data) {
-  data_.insert({key, data});
+  insert_sorted(key, data);
+}
+void AstarteDatastreamObject::insert(std::string&& key, AstarteData&& data) {
+  insert_sorted(std::move(key), std::move(data));
 }
 // Erase element by key
-auto AstarteDatastreamObject::erase(const std::string& key) -> size_type {
-  return data_.erase(key);
+auto AstarteDatastreamObject::erase(std::string_view key) -> size_type {
+  auto iter = find_element(key);
+  if (iter == data_.end()) {
+    return 0;
+  }
+  data_.erase(iter);
+  return 1;
 }
 // Clear the map
 void AstarteDatastreamObject::clear() { data_.clear(); }
 // Find element by key (modifiable)
-auto AstarteDatastreamObject::find(const std::string& key) -> iterator { return data_.find(key); }
+auto AstarteDatastreamObject::find(std::string_view key) -> iterator {
+  return iterator(find_element(key));
+}
 // Find element by key (const)
-auto AstarteDatastreamObject::find(const std::string& key) const -> const_iterator {
-  return data_.find(key);
+auto AstarteDatastreamObject::find(std::string_view key) const -> const_iterator {
+  return const_iterator(find_element(key));
+}
+
+auto AstarteDatastreamObject::find_element(std::string_view key) -> MapType::iterator {
+  auto iter = lower_bound(key);
+  return ((iter != data_.end()) && (iter->first == key)) ? iter : data_.end();
+}
+auto AstarteDatastreamObject::find_element(std::string_view key) const -> MapType::const_iterator {
+  auto iter = lower_bound(key);
+  return ((iter != data_.end()) && (iter->first == key)) ? iter : data_.end();
+}
+
+auto AstarteDatastreamObject::lower_bound(std::string_view key) -> MapType::iterator {
+  return std::lower_bound(data_.begin(), data_.end(), key,
+                          [](const auto& element, std::string_view value) {
+                            return std::string_view(element.first) < value;
+                          });
+}
+auto AstarteDatastreamObject::lower_bound(std::string_view key) const -> MapType::const_iterator {
+  return std::lower_bound(data_.begin(), data_.end(), key,
+                          [](const auto& element, std::string_view value) {
+                            return std::string_view(element.first) < value;
+                          });
+}
+
+template <typename Key, typename Data>
+void AstarteDatastreamObject::insert_sorted(Key&& key, Data&& data) {
+  // Elements are usually inserted in order, checking the back avoids the binary search
+  auto iter = (data_.empty() || (data_.back().first < key)) ? data_.end() : lower_bound(key);
+  if ((iter != data_.end()) && (iter->first == key)) {
+    return;
+  }
+  data_.emplace(iter, std::forward<Key>(key), std::forward<Data>(data));
 }
 
 auto AstarteDatastreamObject::get_raw_data() const -> const MapType& { return this->data_; }
@@ -0,0 +1,41 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/outgoing_msg.hpp"
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <variant>
+
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/property.hpp"
+
+namespace AstarteDeviceSdk {
+
+auto AstarteOutgoingMessage::get_interface() const -> const std::string& { return interface_; }
+
+auto AstarteOutgoingMessage::get_path() const -> const std::string& { return path_; }
+
+auto AstarteOutgoingMessage::get_timestamp() const
+    -> const std::optional<std::chrono::system_clock::time_point>& {
+  return timestamp_;
+}
+
+auto AstarteOutgoingMessage::get_raw_data() const -> const
+    std::variant<AstarteDatastreamIndividual, AstarteDatastreamObject, AstartePropertyIndividual>& {
+  return this->data_;
+}
+
+auto AstarteOutgoingMessage::operator==(const AstarteOutgoingMessage& other) const -> bool {
+  return this->interface_ == other.get_interface() && this->path_ == other.get_path() &&
+         this->data_ == other.get_raw_data() && this->timestamp_ == other.get_timestamp();
+}
+
+auto AstarteOutgoingMessage::operator!=(const AstarteOutgoingMessage& other) const -> bool {
+  return !(*this == other);
+}
+
+}  // namespace AstarteDeviceSdk
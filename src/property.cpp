@@ -5,6 +5,7 @@
 #include "astarte_device_sdk/property.hpp"
 
 #include <optional>
+#include <utility>
 
 #include "astarte_device_sdk/data.hpp"
 
@@ -13,6 +14,9 @@ namespace AstarteDeviceSdk {
 AstartePropertyIndividual::AstartePropertyIndividual(const std::optional<AstarteData>& data)
     : data_(data) {}
 
+AstartePropertyIndividual::AstartePropertyIndividual(std::optional<AstarteData>&& data)
+    : data_(std::move(data)) {}
+
 auto AstartePropertyIndividual::get_value() const -> const std::optional<AstarteData>& {
   return data_;
 }
@@ -0,0 +1,304 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "segment_log.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+// Each record is stored as: sequence number (8 bytes), expiry (8 bytes), payload size (4 bytes)
+// and the payload itself. All integers are little endian.
+constexpr std::size_t header_size = 20;
+constexpr std::string_view segment_extension = ".seg";
+constexpr std::size_t segment_name_digits = 20;
+// The cursor holds the index of the segment being read (8 bytes) and the read offset (8 bytes)
+constexpr std::string_view cursor_name = "read.pos";
+constexpr std::size_t cursor_size = 16;
+
+void put_le(std::string& buffer, std::uint64_t value, std::size_t bytes) {
+  for (std::size_t i = 0; i < bytes; i++) {
+    buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+auto get_le(const std::array<char, header_size>& buffer, std::size_t offset, std::size_t bytes)
+    -> std::uint64_t {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < bytes; i++) {
+    value |= static_cast<std::uint64_t>(static_cast<unsigned char>(buffer.at(offset + i)))
+             << (8 * i);
+  }
+  return value;
+}
+
+auto segment_name(std::uint64_t index) -> std::string {
+  std::string name = std::to_string(index);
+  name.insert(0, segment_name_digits - std::min(name.size(), segment_name_digits), '0');
+  name.append(segment_extension);
+  return name;
+}
+
+auto parse_segment_index(const std::filesystem::path& path) -> std::optional<std::uint64_t> {
+  const std::string stem = path.stem().string();
+  if ((path.extension() != segment_extension) || stem.empty() ||
+      !std::all_of(stem.begin(), stem.end(), [](char chr) { return chr >= '0' && chr <= '9'; })) {
+    return std::nullopt;
+  }
+  return std::stoull(stem);
+}
+
+}  // namespace
+
+SegmentLog::SegmentLog(std::filesystem::path dir, std::uintmax_t segment_size,
+                       std::uintmax_t max_size)
+    : dir_(std::move(dir)),
+      cursor_path_(dir_ / cursor_name),
+      segment_size_(segment_size),
+      max_size_(max_size) {}
+
+auto SegmentLog::open(const std::filesystem::path& dir, std::uintmax_t segment_size,
+                      std::uintmax_t max_size) -> astarte_tl::expected<SegmentLog, AstarteError> {
+  std::error_code err;
+  std::filesystem::create_directories(dir, err);
+  if (err) {
+    spdlog::error("Could not create the storage directory {}: {}", dir.string(), err.message());
+    return astarte_tl::unexpected(AstarteFileOpenError{dir.string()});
+  }
+
+  SegmentLog log(dir, segment_size, max_size);
+  for (const auto& entry : std::filesystem::directory_iterator(dir, err)) {
+    auto index = parse_segment_index(entry.path());
+    if (entry.is_regular_file() && index) {
+      log.segments_.push_back(
+          Segment{.index = index.value(), .path = entry.path(), .size = entry.file_size()});
+    }
+  }
+  if (err) {
+    spdlog::error("Could not read the storage directory {}: {}", dir.string(), err.message());
+    return astarte_tl::unexpected(AstarteFileOpenError{dir.string()});
+  }
+  std::sort(log.segments_.begin(), log.segments_.end(),
+            [](const Segment& lhs, const Segment& rhs) { return lhs.index < rhs.index; });
+
+  // Segments before the cursor have been consumed, their removal was interrupted
+  const auto cursor = read_cursor(log.cursor_path_);
+  if (cursor) {
+    while (!log.segments_.empty() && (log.segments_.front().index < cursor->first)) {
+      std::filesystem::remove(log.segments_.front().path, err);
+      log.segments_.pop_front();
+    }
+    log.next_index_ = cursor->first + 1;
+  }
+
+  if (!log.segments_.empty()) {
+    // Scan the last segment to recover the last sequence number and drop any partially
+    // written record, left behind by an interrupted write.
+    Segment& last = log.segments_.back();
+    std::ifstream stream(last.path, std::ios::binary);
+    std::uintmax_t valid_size = 0;
+    while (auto record = read_record(stream, last.size - valid_size)) {
+      valid_size += header_size + record->payload.size();
+      log.last_seq_ = record->seq;
+    }
+    stream.close();
+    if (valid_size != last.size) {
+      spdlog::warn("Truncating incomplete record in {}", last.path.string());
+      std::filesystem::resize_file(last.path, valid_size, err);
+      last.size = valid_size;
+    }
+    for (const auto& segment : log.segments_) {
+      log.total_size_ += segment.size;
+    }
+    if (cursor && (log.segments_.front().index == cursor->first)) {
+      log.read_offset_ = std::min(cursor->second, log.segments_.front().size);
+    }
+    log.next_index_ = std::max(log.next_index_, last.index + 1);
+    log.writer_.open(last.path, std::ios::binary | std::ios::app);
+    if (!log.writer_.is_open()) {
+      spdlog::error("Could not open the segment file {}", last.path.string());
+      return astarte_tl::unexpected(AstarteFileOpenError{last.path.string()});
+    }
+  }
+
+  return log;
+}
+
+auto SegmentLog::append(const Record& record) -> astarte_tl::expected<void, AstarteError> {
+  if (segments_.empty() || (segments_.back().size >= segment_size_)) {
+    auto res = start_segment();
+    if (!res) {
+      return res;
+    }
+  }
+
+  std::string buffer;
+  buffer.reserve(header_size + record.payload.size());
+  put_le(buffer, record.seq, sizeof(std::uint64_t));
+  put_le(buffer, static_cast<std::uint64_t>(record.expiry_ms), sizeof(std::int64_t));
+  put_le(buffer, static_cast<std::uint32_t>(record.payload.size()), sizeof(std::uint32_t));
+  buffer.append(record.payload);
+
+  writer_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  writer_.flush();
+  if (!writer_.good()) {
+    spdlog::error("Could not write to the segment file {}", segments_.back().path.string());
+    return astarte_tl::unexpected(AstarteFileOpenError{segments_.back().path.string()});
+  }
+  segments_.back().size += buffer.size();
+  total_size_ += buffer.size();
+  last_seq_ = record.seq;
+
+  enforce_max_size();
+  return {};
+}
+
+auto SegmentLog::front() -> const Record* {
+  while (!head_ && !segments_.empty()) {
+    const Segment& segment = segments_.front();
+    if (read_offset_ < segment.size) {
+      if (!reader_.is_open()) {
+        reader_.open(segment.path, std::ios::binary);
+      }
+      // The segment might have grown since the last read, clear the end of file state
+      reader_.clear();
+      reader_.seekg(static_cast<std::streamoff>(read_offset_));
+      head_ = read_record(reader_, segment.size - read_offset_);
+      if (head_) {
+        break;
+      }
+      spdlog::warn("Corrupted record in {}, skipping the segment", segment.path.string());
+    }
+    // The last segment is the one being written, it is removed only once fully consumed and the
+    // next append starts a new one
+    if (segments_.size() == 1) {
+      if (read_offset_ < segment.size) {
+        break;
+      }
+      writer_.close();
+    }
+    drop_front_segment();
+  }
+  return head_ ? &head_.value() : nullptr;
+}
+
+void SegmentLog::pop() {
+  if (front() != nullptr) {
+    read_offset_ += header_size + head_->payload.size();
+    head_.reset();
+    write_cursor();
+  }
+}
+
+auto SegmentLog::empty() -> bool { return front() == nullptr; }
+
+auto SegmentLog::last_seq() const -> std::optional<std::uint64_t> { return last_seq_; }
+
+auto SegmentLog::read_record(std::ifstream& stream, std::uintmax_t available)
+    -> std::optional<Record> {
+  if (available < header_size) {
+    return std::nullopt;
+  }
+  std::array<char, header_size> header{};
+  stream.read(header.data(), header.size());
+  if (stream.gcount() != static_cast<std::streamsize>(header.size())) {
+    return std::nullopt;
+  }
+  Record record{.seq = get_le(header, 0, sizeof(std::uint64_t)),
+                .expiry_ms = static_cast<std::int64_t>(get_le(header, 8, sizeof(std::int64_t))),
+                .payload = std::string()};
+  const auto payload_size = static_cast<std::size_t>(get_le(header, 16, sizeof(std::uint32_t)));
+  if (payload_size > available - header_size) {
+    return std::nullopt;
+  }
+  record.payload.resize(payload_size);
+  stream.read(record.payload.data(), static_cast<std::streamsize>(payload_size));
+  if (stream.gcount() != static_cast<std::streamsize>(payload_size)) {
+    return std::nullopt;
+  }
+  return record;
+}
+
+auto SegmentLog::read_cursor(const std::filesystem::path& path)
+    -> std::optional<std::pair<std::uint64_t, std::uintmax_t>> {
+  std::ifstream stream(path, std::ios::binary);
+  std::array<char, header_size> buffer{};
+  stream.read(buffer.data(), cursor_size);
+  if (stream.gcount() != static_cast<std::streamsize>(cursor_size)) {
+    return std::nullopt;
+  }
+  return std::make_pair(get_le(buffer, 0, sizeof(std::uint64_t)),
+                        static_cast<std::uintmax_t>(get_le(buffer, 8, sizeof(std::uint64_t))));
+}
+
+void SegmentLog::write_cursor() {
+  std::string buffer;
+  buffer.reserve(cursor_size);
+  put_le(buffer, segments_.front().index, sizeof(std::uint64_t));
+  put_le(buffer, read_offset_, sizeof(std::uint64_t));
+  std::ofstream stream(cursor_path_, std::ios::binary | std::ios::trunc);
+  stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  stream.flush();
+  if (!stream.good()) {
+    spdlog::warn("Could not persist the read position to {}", cursor_path_.string());
+  }
+}
+
+auto SegmentLog::start_segment() -> astarte_tl::expected<void, AstarteError> {
+  const std::uint64_t index = next_index_++;
+  const std::filesystem::path path = dir_ / segment_name(index);
+  writer_.close();
+  writer_.open(path, std::ios::binary | std::ios::app);
+  if (!writer_.is_open()) {
+    spdlog::error("Could not open the segment file {}", path.string());
+    return astarte_tl::unexpected(AstarteFileOpenError{path.string()});
+  }
+  segments_.push_back(Segment{.index = index, .path = path, .size = 0});
+  return {};
+}
+
+void SegmentLog::drop_front_segment() {
+  reader_.close();
+  read_offset_ = 0;
+  head_.reset();
+  std::error_code err;
+  std::filesystem::remove(segments_.front().path, err);
+  if (err) {
+    spdlog::warn("Could not remove the segment file {}: {}", segments_.front().path.string(),
+                 err.message());
+  }
+  total_size_ -= segments_.front().size;
+  segments_.pop_front();
+}
+
+void SegmentLog::enforce_max_size() {
+  while ((total_size_ > max_size_) && (segments_.size() > 1)) {
+    spdlog::warn("Storage size exceeded, discarding the oldest stored messages");
+    drop_front_segment();
+  }
+}
+
+}  // namespace AstarteDeviceSdk
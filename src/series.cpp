@@ -0,0 +1,81 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/series.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+namespace AstarteDeviceSdk {
+
+void AstarteDatastreamSeries::reserve(std::size_t capacity) {
+  std::visit([capacity](auto& values) { values.reserve(capacity); }, values_);
+  timestamps_.reserve(capacity);
+}
+
+void AstarteDatastreamSeries::clear() {
+  std::visit([](auto& values) { values.clear(); }, values_);
+  timestamps_.clear();
+}
+
+auto AstarteDatastreamSeries::size() const -> std::size_t {
+  return std::visit([](const auto& values) { return values.size(); }, values_);
+}
+
+auto AstarteDatastreamSeries::empty() const -> bool { return size() == 0; }
+
+auto AstarteDatastreamSeries::get_type() const -> AstarteType {
+  struct Visitor {
+    auto operator()(const std::vector<int32_t>& /*unused*/) -> AstarteType { return kInteger; }
+    auto operator()(const std::vector<int64_t>& /*unused*/) -> AstarteType {
+      return kLongInteger;
+    }
+    auto operator()(const std::vector<double>& /*unused*/) -> AstarteType { return kDouble; }
+    auto operator()(const std::vector<bool>& /*unused*/) -> AstarteType { return kBoolean; }
+    auto operator()(const std::vector<std::string>& /*unused*/) -> AstarteType { return kString; }
+    auto operator()(const std::vector<std::vector<uint8_t>>& /*unused*/) -> AstarteType {
+      return kBinaryBlob;
+    }
+    auto operator()(const std::vector<std::chrono::system_clock::time_point>& /*unused*/)
+        -> AstarteType {
+      return kDatetime;
+    }
+  };
+  return std::visit(Visitor{}, values_);
+}
+
+auto AstarteDatastreamSeries::get_timestamps() const
+    -> const std::vector<std::chrono::system_clock::time_point>& {
+  return timestamps_;
+}
+
+auto AstarteDatastreamSeries::get_raw_data() const -> const VariantType& { return values_; }
+
+auto AstarteDatastreamSeries::value_at(std::size_t index) const -> AstarteData {
+  return std::visit(
+      [index](const auto& values) {
+        using ValueType = typename std::decay_t<decltype(values)>::value_type;
+        // Elements of vector<bool> are proxies, convert them back to a boolean
+        return AstarteData(static_cast<ValueType>(values.at(index)));
+      },
+      values_);
+}
+
+auto AstarteDatastreamSeries::operator==(const AstarteDatastreamSeries& other) const -> bool {
+  return this->values_ == other.get_raw_data() && this->timestamps_ == other.get_timestamps();
+}
+
+auto AstarteDatastreamSeries::operator!=(const AstarteDatastreamSeries& other) const -> bool {
+  return !(*this == other);
+}
+
+}  // namespace AstarteDeviceSdk
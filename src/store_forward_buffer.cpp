@@ -0,0 +1,171 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "store_forward_buffer.hpp"
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/store_forward.hpp"
+#include "interface.hpp"
+#include "segment_log.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+constexpr std::uintmax_t min_segment_size = 4 * 1024;
+constexpr std::uintmax_t max_segment_size = 1024 * 1024;
+
+auto now_ms() -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+auto is_expired(std::int64_t expiry_ms) -> bool {
+  return (expiry_ms != 0) && (expiry_ms < now_ms());
+}
+
+}  // namespace
+
+StoreForwardBuffer::StoreForwardBuffer(std::size_t volatile_capacity,
+                                       std::optional<SegmentLog> log)
+    : volatile_capacity_(volatile_capacity), log_(std::move(log)) {
+  if (log_ && log_->last_seq()) {
+    next_seq_ = log_->last_seq().value() + 1;
+  }
+}
+
+auto StoreForwardBuffer::create(const AstarteStoreForwardConfig& config)
+    -> astarte_tl::expected<std::unique_ptr<StoreForwardBuffer>, AstarteError> {
+  if (config.volatile_capacity == 0) {
+    return astarte_tl::unexpected(
+        AstarteInvalidInputError{"The volatile capacity should be greater than zero."});
+  }
+
+  std::optional<SegmentLog> log;
+  if (!config.storage_dir.empty()) {
+    const std::uintmax_t segment_size =
+        std::clamp(config.storage_max_size / 8, min_segment_size, max_segment_size);
+    auto res = SegmentLog::open(config.storage_dir, segment_size, config.storage_max_size);
+    if (!res) {
+      return astarte_tl::unexpected(res.error());
+    }
+    log.emplace(std::move(res.value()));
+  } else {
+    spdlog::warn("No storage directory configured, stored messages will be kept in memory.");
+  }
+
+  return std::unique_ptr<StoreForwardBuffer>(
+      new StoreForwardBuffer(config.volatile_capacity, std::move(log)));
+}
+
+auto StoreForwardBuffer::push(const gRPCAstarteMessage& message, AstarteRetention retention,
+                              std::chrono::seconds expiry)
+    -> astarte_tl::expected<void, AstarteError> {
+  const std::int64_t expiry_ms =
+      (expiry.count() == 0)
+          ? 0
+          : now_ms() + std::chrono::duration_cast<std::chrono::milliseconds>(expiry).count();
+
+  std::unique_lock<std::mutex> mlock(mutex_);
+  if ((retention == AstarteRetention::kStored) && log_) {
+    std::string payload;
+    if (!message.SerializeToString(&payload)) {
+      return astarte_tl::unexpected(AstarteInternalError{"Could not serialize the message."});
+    }
+    auto res = log_->append(SegmentLog::Record{
+        .seq = next_seq_, .expiry_ms = expiry_ms, .payload = std::move(payload)});
+    if (!res) {
+      return res;
+    }
+  } else {
+    if (volatile_.size() >= volatile_capacity_) {
+      spdlog::warn("Volatile buffer full, discarding the oldest message");
+      volatile_.pop_front();
+    }
+    volatile_.push_back(
+        VolatileEntry{.seq = next_seq_, .expiry_ms = expiry_ms, .message = message});
+  }
+  next_seq_++;
+  condition_.notify_one();
+  return {};
+}
+
+auto StoreForwardBuffer::front(const std::chrono::milliseconds& timeout) -> std::optional<Entry> {
+  std::unique_lock<std::mutex> mlock(mutex_);
+  if (!condition_.wait_for(mlock, timeout, [this] { return !empty_locked(); })) {
+    return std::nullopt;
+  }
+  while (!empty_locked()) {
+    if (volatile_is_next()) {
+      const VolatileEntry& entry = volatile_.front();
+      if (!is_expired(entry.expiry_ms)) {
+        return Entry{.seq = entry.seq, .message = entry.message};
+      }
+      volatile_.pop_front();
+    } else {
+      const SegmentLog::Record* record = log_->front();
+      if (!is_expired(record->expiry_ms)) {
+        Entry stored{.seq = record->seq, .message = gRPCAstarteMessage()};
+        if (stored.message.ParseFromString(record->payload)) {
+          return stored;
+        }
+        spdlog::warn("Discarding a stored message that could not be parsed");
+      }
+      log_->pop();
+    }
+    spdlog::debug("Discarding an expired buffered message");
+  }
+  return std::nullopt;
+}
+
+void StoreForwardBuffer::pop(std::uint64_t seq) {
+  std::unique_lock<std::mutex> mlock(mutex_);
+  // Sequence numbers only grow, if still buffered the message is at the front of its storage
+  if (!volatile_.empty() && (volatile_.front().seq == seq)) {
+    volatile_.pop_front();
+  } else if (log_ && !log_->empty() && (log_->front()->seq == seq)) {
+    log_->pop();
+  }
+}
+
+auto StoreForwardBuffer::empty() -> bool {
+  std::unique_lock<std::mutex> mlock(mutex_);
+  return empty_locked();
+}
+
+auto StoreForwardBuffer::empty_locked() -> bool {
+  return volatile_.empty() && (!log_ || log_->empty());
+}
+
+auto StoreForwardBuffer::volatile_is_next() -> bool {
+  if (volatile_.empty()) {
+    return false;
+  }
+  if (!log_ || log_->empty()) {
+    return true;
+  }
+  return volatile_.front().seq < log_->front()->seq;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/interned_string.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 
 namespace AstarteDeviceSdk {
@@ -24,10 +25,14 @@ AstarteStoredProperty::AstarteStoredProperty(std::string_view interface_name, st
       data_(std::move(data)) {}
 
 auto AstarteStoredProperty::get_interface_name() const -> const std::string& {
-  return interface_name_;
+  return interface_name_.get();
 }
 
-auto AstarteStoredProperty::get_path() const -> const std::string& { return path_; }
+auto AstarteStoredProperty::get_path() const -> const std::string& { return path_.get(); }
+
+auto AstarteStoredProperty::get_interface_handle() const -> const AstarteInternedString& {
+  return interface_name_;
+}
 
 auto AstarteStoredProperty::get_version_major() const -> int32_t { return version_major_; }
 
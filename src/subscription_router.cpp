@@ -0,0 +1,156 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "subscription_router.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(ASTARTE_USE_TL_EXPECTED)
+#include "tl/expected.hpp"
+#else
+#include <expected>
+#endif
+
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/message_handler.hpp"
+#include "astarte_device_sdk/msg.hpp"
+
+namespace AstarteDeviceSdk {
+
+auto SubscriptionRouter::subscribe(std::string_view interface_name, std::string_view path_pattern,
+                                   AstarteMessageHandler handler)
+    -> astarte_tl::expected<AstarteSubscriptionId, AstarteError> {
+  if (interface_name.empty()) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{"The interface name is empty."});
+  }
+  if (!handler) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{"The subscription handler is empty."});
+  }
+  return split_pattern(path_pattern).transform([&](std::vector<std::string>&& segments) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const AstarteSubscriptionId subscription = next_id_++;
+    subscriptions_.emplace(
+        subscription,
+        Subscription{.interface_name = std::string(interface_name),
+                     .segments = std::move(segments),
+                     .handler = std::make_shared<const AstarteMessageHandler>(std::move(handler))});
+    rebuild();
+    return subscription;
+  });
+}
+
+auto SubscriptionRouter::unsubscribe(AstarteSubscriptionId subscription) -> bool {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (subscriptions_.erase(subscription) == 0) {
+    return false;
+  }
+  rebuild();
+  return true;
+}
+
+auto SubscriptionRouter::empty() -> bool {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return subscriptions_.empty();
+}
+
+auto SubscriptionRouter::route(const AstarteMessage& message) -> std::size_t {
+  std::shared_ptr<const Trie> trie;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    trie = trie_;
+  }
+  auto root = trie->find(std::string_view(message.get_interface()));
+  if (root == trie->end()) {
+    return 0;
+  }
+  return match(root->second, message.get_path(), message);
+}
+
+auto SubscriptionRouter::split_pattern(std::string_view path_pattern)
+    -> astarte_tl::expected<std::vector<std::string>, AstarteError> {
+  if (path_pattern.empty() || (path_pattern.front() != '/')) {
+    return astarte_tl::unexpected(AstarteInvalidInputError{
+        "The path pattern should start with '/': " + std::string(path_pattern)});
+  }
+  std::vector<std::string> segments;
+  std::string_view rest = path_pattern.substr(1);
+  while (true) {
+    const std::size_t end = rest.find('/');
+    const std::string_view segment = rest.substr(0, end);
+    const bool malformed_parameter =
+        !is_parameter(segment) && (segment.find_first_of("%{}") != std::string_view::npos);
+    if (segment.empty() || malformed_parameter) {
+      return astarte_tl::unexpected(AstarteInvalidInputError{
+          "Invalid segment in the path pattern: " + std::string(path_pattern)});
+    }
+    segments.emplace_back(segment);
+    if (end == std::string_view::npos) {
+      break;
+    }
+    rest = rest.substr(end + 1);
+  }
+  return segments;
+}
+
+auto SubscriptionRouter::is_parameter(std::string_view segment) -> bool {
+  return (segment.size() > 3) && segment.starts_with("%{") && segment.ends_with('}') &&
+         (segment.substr(2, segment.size() - 3).find_first_of("%{}/") == std::string_view::npos);
+}
+
+auto SubscriptionRouter::match(const Node& node, std::string_view path,
+                               const AstarteMessage& message) -> std::size_t {
+  if (path.empty()) {
+    for (const auto& handler : node.handlers) {
+      (*handler)(message);
+    }
+    return node.handlers.size();
+  }
+  if (path.front() != '/') {
+    return 0;
+  }
+  path.remove_prefix(1);
+  const std::size_t end = path.find('/');
+  const std::string_view segment = path.substr(0, end);
+  const std::string_view rest = (end == std::string_view::npos) ? "" : path.substr(end);
+
+  std::size_t matched = 0;
+  auto child = node.children.find(segment);
+  if (child != node.children.end()) {
+    matched += match(child->second, rest, message);
+  }
+  if (node.parameter && !segment.empty()) {
+    matched += match(*node.parameter, rest, message);
+  }
+  return matched;
+}
+
+void SubscriptionRouter::rebuild() {
+  auto trie = std::make_shared<Trie>();
+  for (const auto& [id, subscription] : subscriptions_) {
+    Node* node = &(*trie)[subscription.interface_name];
+    for (const std::string& segment : subscription.segments) {
+      if (is_parameter(segment)) {
+        if (!node->parameter) {
+          node->parameter = std::make_unique<Node>();
+        }
+        node = node->parameter.get();
+      } else {
+        node = &node->children[segment];
+      }
+    }
+    node->handlers.push_back(subscription.handler);
+  }
+  spdlog::debug("Subscriptions have been rebuilt, subscriptions: {}", subscriptions_.size());
+  trie_ = std::move(trie);
+}
+
+}  // namespace AstarteDeviceSdk
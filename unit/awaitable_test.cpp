@@ -0,0 +1,140 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/awaitable.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/msg.hpp"
+
+using AstarteDeviceSdk::AstarteAwaitable;
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDeviceGrpc;
+using AstarteDeviceSdk::AstarteError;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstarteOperationRefusedError;
+using AstarteDeviceSdk::AstarteUseAwaitable;
+using AstarteDeviceSdk::use_awaitable;
+namespace astarte_tl = AstarteDeviceSdk::astarte_tl;
+
+namespace {
+// Eagerly started coroutine that is never awaited
+struct Task {
+  struct promise_type {
+    auto get_return_object() -> Task { return {}; }
+    auto initial_suspend() -> std::suspend_never { return {}; }
+    auto final_suspend() noexcept -> std::suspend_never { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+template <typename T>
+auto await_into(AstarteAwaitable<T> awaitable, std::optional<T>& out, std::thread::id& resumed_on)
+    -> Task {
+  out = co_await awaitable;
+  resumed_on = std::this_thread::get_id();
+}
+
+using IntAwaitable = AstarteAwaitable<int>;
+
+constexpr std::string_view property_interface = R"({
+  "interface_name": "org.astarte.test.Property",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "properties",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/value", "type": "integer"}]
+})";
+}  // namespace
+
+TEST(AstarteTestAwaitable, CompletedBeforeAwait) {
+  auto state = std::make_shared<IntAwaitable::State>(nullptr);
+  state->complete(42);
+  std::optional<int> result;
+  std::thread::id resumed_on;
+  await_into(IntAwaitable(state), result, resumed_on);
+  EXPECT_EQ(result, 42);
+  EXPECT_EQ(resumed_on, std::this_thread::get_id());
+}
+
+TEST(AstarteTestAwaitable, ResumedOnCompletingThread) {
+  auto state = std::make_shared<IntAwaitable::State>(nullptr);
+  std::optional<int> result;
+  std::thread::id resumed_on;
+  await_into(IntAwaitable(state), result, resumed_on);
+  EXPECT_FALSE(result.has_value());
+
+  std::thread::id completing;
+  std::jthread completer([&state, &completing]() {
+    completing = std::this_thread::get_id();
+    state->complete(7);
+  });
+  completer.join();
+  EXPECT_EQ(result, 7);
+  EXPECT_EQ(resumed_on, completing);
+}
+
+TEST(AstarteTestAwaitable, ResumedOnExecutor) {
+  std::vector<std::coroutine_handle<>> scheduled;
+  auto state = std::make_shared<IntAwaitable::State>(
+      [&scheduled](std::coroutine_handle<> handle) { scheduled.push_back(handle); });
+  std::optional<int> result;
+  std::thread::id resumed_on;
+  await_into(IntAwaitable(state), result, resumed_on);
+
+  state->complete(3);
+  EXPECT_FALSE(result.has_value());
+  ASSERT_EQ(scheduled.size(), 1);
+  scheduled.front().resume();
+  EXPECT_EQ(result, 3);
+  EXPECT_EQ(resumed_on, std::this_thread::get_id());
+}
+
+TEST(AstarteTestAwaitable, SendWhileDisconnectedFails) {
+  AstarteDeviceGrpc device("localhost:1", "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(property_interface));
+  std::optional<astarte_tl::expected<void, AstarteError>> result;
+  std::thread::id resumed_on;
+  await_into(device.set_property_async("org.astarte.test.Property", "/value", AstarteData(1),
+                                       use_awaitable),
+             result, resumed_on);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_FALSE(result->has_value());
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(result->error()));
+}
+
+TEST(AstarteTestAwaitable, PendingMessageWaitFailsOnDestruction) {
+  std::optional<astarte_tl::expected<AstarteMessage, AstarteError>> result;
+  std::thread::id resumed_on;
+  std::atomic<int> scheduled{0};
+  {
+    AstarteDeviceGrpc device("localhost:1", "test-node-uuid");
+    const AstarteUseAwaitable token{[&scheduled](std::coroutine_handle<> handle) {
+      scheduled++;
+      handle.resume();
+    }};
+    await_into(device.next_message(token), result, resumed_on);
+    EXPECT_FALSE(result.has_value());
+  }
+  EXPECT_EQ(scheduled, 1);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_FALSE(result->has_value());
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(result->error()));
+}
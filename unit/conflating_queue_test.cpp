@@ -0,0 +1,137 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "conflating_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "astarte_device_sdk/property.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstarteOverflowPolicy;
+using AstarteDeviceSdk::AstartePropertyIndividual;
+using AstarteDeviceSdk::ConflatingQueue;
+using AstarteDeviceSdk::PropertyConflationKey;
+
+namespace {
+using MessageQueue = ConflatingQueue<AstarteMessage, PropertyConflationKey>;
+
+constexpr std::string_view property_interface("org.astarte.test.ServerProperty");
+constexpr std::string_view datastream_interface("org.astarte.test.ServerDatastream");
+
+auto make_property(std::string_view path, std::optional<int32_t> value) -> AstarteMessage {
+  std::optional<AstarteData> data;
+  if (value) {
+    data = AstarteData(value.value());
+  }
+  return {property_interface, path, AstartePropertyIndividual(data)};
+}
+
+auto make_datastream(int32_t value) -> AstarteMessage {
+  return {datastream_interface, "/value", AstarteDatastreamIndividual(AstarteData(value))};
+}
+
+auto property_value(const AstarteMessage& message) -> std::optional<int32_t> {
+  const auto& data = message.into<AstartePropertyIndividual>().get_value();
+  if (!data) {
+    return std::nullopt;
+  }
+  return data->into<int32_t>();
+}
+}  // namespace
+
+TEST(AstarteTestConflatingQueue, PropertiesReplacedInPlace) {
+  MessageQueue queue;
+  queue.push(make_property("/a", 1));
+  queue.push(make_datastream(10));
+  queue.push(make_property("/b", 2));
+  queue.push(make_property("/a", 3));
+  queue.push(make_datastream(11));
+  queue.push(make_property("/a", 4));
+
+  EXPECT_EQ(queue.size(), 4);
+  EXPECT_EQ(queue.conflated(), 2);
+  std::vector<AstarteMessage> out;
+  ASSERT_EQ(queue.pop_batch(out, 10, std::chrono::milliseconds(0)), 4);
+  EXPECT_EQ(out[0].get_path(), "/a");
+  EXPECT_EQ(property_value(out[0]), 4);
+  EXPECT_TRUE(out[1].is_datastream());
+  EXPECT_EQ(out[2].get_path(), "/b");
+  EXPECT_EQ(property_value(out[2]), 2);
+  EXPECT_TRUE(out[3].is_datastream());
+}
+
+TEST(AstarteTestConflatingQueue, UnsetReplacesPendingValue) {
+  MessageQueue queue;
+  queue.push(make_property("/a", 1));
+  queue.push(make_property("/a", std::nullopt));
+  auto message = queue.pop(std::chrono::milliseconds(0));
+  ASSERT_TRUE(message.has_value());
+  EXPECT_FALSE(property_value(message.value()).has_value());
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(AstarteTestConflatingQueue, PoppedPropertyIsNotReplaced) {
+  MessageQueue queue;
+  queue.push(make_property("/a", 1));
+  auto first = queue.pop(std::chrono::milliseconds(0));
+  ASSERT_TRUE(first.has_value());
+  queue.push(make_property("/a", 2));
+  auto second = queue.pop(std::chrono::milliseconds(0));
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(property_value(first.value()), 1);
+  EXPECT_EQ(property_value(second.value()), 2);
+  EXPECT_EQ(queue.conflated(), 0);
+}
+
+TEST(AstarteTestConflatingQueue, FullQueueStillConflates) {
+  MessageQueue queue(2, AstarteOverflowPolicy::kDropNewest);
+  EXPECT_TRUE(queue.push(make_property("/a", 1)));
+  EXPECT_TRUE(queue.push(make_datastream(10)));
+  EXPECT_TRUE(queue.push(make_property("/a", 2)));
+  EXPECT_FALSE(queue.push(make_datastream(11)));
+  EXPECT_EQ(queue.dropped(), 1);
+  EXPECT_EQ(queue.size(), 2);
+}
+
+TEST(AstarteTestConflatingQueue, DropOldestForgetsDroppedKey) {
+  MessageQueue queue(1, AstarteOverflowPolicy::kDropOldest);
+  queue.push(make_property("/a", 1));
+  queue.push(make_datastream(10));
+  queue.push(make_property("/a", 2));
+  EXPECT_EQ(queue.dropped(), 2);
+  auto message = queue.pop(std::chrono::milliseconds(0));
+  ASSERT_TRUE(message.has_value());
+  EXPECT_EQ(property_value(message.value()), 2);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(AstarteTestConflatingQueue, PopBatchReleasesAllBlockedProducers) {
+  MessageQueue queue(2, AstarteOverflowPolicy::kBlock);
+  EXPECT_TRUE(queue.push(make_datastream(0)));
+  EXPECT_TRUE(queue.push(make_datastream(1)));
+  std::vector<std::jthread> producers;
+  for (int32_t i = 2; i < 4; ++i) {
+    producers.emplace_back([&queue, i]() { EXPECT_TRUE(queue.push(make_datastream(i))); });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  std::vector<AstarteMessage> out;
+  EXPECT_EQ(queue.pop_batch(out, 2, std::chrono::milliseconds(0)), 2);
+  // Both producers are woken up by a single batch
+  producers.clear();
+  EXPECT_EQ(queue.size(), 2);
+}
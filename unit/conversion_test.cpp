@@ -5,22 +5,156 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "grpc_arena.hpp"
 #include "grpc_converter.hpp"
 
 using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDataView;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteMessage;
 using AstarteDeviceSdk::gRPCAstarteData;
+using AstarteDeviceSdk::gRPCAstarteDatastreamObject;
+using AstarteDeviceSdk::gRPCAstarteMessage;
 using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcArenaLease;
 using AstarteDeviceSdk::GrpcConverterTo;
+using AstarteDeviceSdk::GrpcMessageArena;
 
 TEST(AstarteTestConversion, DataToGrpc) {
   int32_t value = 199;
   auto data = AstarteData(value);
   std::unique_ptr<gRPCAstarteData> grpc_individual =
-      std::visit(GrpcConverterTo(), data.get_raw_data());
+      data.visit(GrpcConverterTo());
   EXPECT_EQ(grpc_individual->astarte_data_case(), gRPCAstarteData::kInteger);
   EXPECT_EQ(grpc_individual->integer(), value);
   GrpcConverterFrom converter;
   AstarteData original = converter(*grpc_individual).value();
   EXPECT_EQ(original.into<int32_t>(), value);
 }
+
+TEST(AstarteTestConversion, FillOnArenaOverwrites) {
+  GrpcMessageArena arena;
+  auto* grpc_data = arena.create<gRPCAstarteData>();
+  GrpcConverterTo::fill(AstarteData(std::vector<int64_t>{1, 2, 3}), grpc_data);
+  EXPECT_EQ(grpc_data->astarte_data_case(), gRPCAstarteData::kLongIntegerArray);
+  EXPECT_EQ(grpc_data->long_integer_array().values_size(), 3);
+
+  GrpcConverterTo::fill(AstarteData(std::string("hello")), grpc_data);
+  EXPECT_EQ(grpc_data->astarte_data_case(), gRPCAstarteData::kString);
+  AstarteData original = GrpcConverterFrom{}(*grpc_data).value();
+  EXPECT_EQ(original.into<std::string>(), "hello");
+  EXPECT_EQ(arena.space_allocated(), GrpcMessageArena::initial_block_size);
+}
+
+TEST(AstarteTestConversion, FillSameArrayTypeReplacesElements) {
+  GrpcMessageArena arena;
+  auto* grpc_data = arena.create<gRPCAstarteData>();
+  GrpcConverterTo::fill(AstarteData(std::vector<int32_t>{1, 2, 3}), grpc_data);
+  GrpcConverterTo::fill(AstarteData(std::vector<int32_t>{4, 5}), grpc_data);
+  EXPECT_EQ(GrpcConverterFrom{}(*grpc_data).value(), AstarteData(std::vector<int32_t>{4, 5}));
+
+  const std::vector<std::string> strings = {"c"};
+  GrpcConverterTo::fill(AstarteData(std::vector<std::string>{"a", "b"}), grpc_data);
+  GrpcConverterTo::fill(AstarteDataView(strings), grpc_data);
+  EXPECT_EQ(GrpcConverterFrom{}(*grpc_data).value(), AstarteData(strings));
+
+  const std::vector<double> doubles = {1.5};
+  GrpcConverterTo::fill(AstarteDataView(doubles), grpc_data);
+  GrpcConverterTo::fill(AstarteDataView(doubles), grpc_data);
+  EXPECT_EQ(GrpcConverterFrom{}(*grpc_data).value(), AstarteData(doubles));
+}
+
+TEST(AstarteTestConversion, FillObjectOnArena) {
+  GrpcMessageArena arena;
+  auto* grpc_object = arena.create<gRPCAstarteDatastreamObject>();
+  AstarteDatastreamObject first = {{"a", AstarteData(int32_t{1})}, {"b", AstarteData(2.5)}};
+  GrpcConverterTo::fill(first, nullptr, grpc_object);
+  EXPECT_EQ(grpc_object->data_size(), 2);
+  EXPECT_FALSE(grpc_object->has_timestamp());
+
+  const auto now = std::chrono::system_clock::now();
+  AstarteDatastreamObject second = {{"c", AstarteData(true)}};
+  GrpcConverterTo::fill(second, &now, grpc_object);
+  EXPECT_EQ(grpc_object->data_size(), 1);
+  EXPECT_TRUE(grpc_object->has_timestamp());
+  EXPECT_EQ(GrpcConverterFrom{}(*grpc_object).value(), second);
+}
+
+TEST(AstarteTestConversion, FillMovesStrings) {
+  GrpcMessageArena arena;
+  std::string value(1024, 'x');
+  const char* buffer = value.data();
+  auto* grpc_data = arena.create<gRPCAstarteData>();
+  GrpcConverterTo::fill(AstarteData(std::move(value)), grpc_data);
+  EXPECT_EQ(grpc_data->astarte_data_case(), gRPCAstarteData::kString);
+  EXPECT_EQ(grpc_data->string().data(), buffer);
+
+  AstarteDatastreamObject object = {{"label", AstarteData(std::string(1024, 'y'))}};
+  buffer = object.at("label").into<std::string>().data();
+  auto* grpc_object = arena.create<gRPCAstarteDatastreamObject>();
+  GrpcConverterTo::fill(std::move(object), nullptr, grpc_object);
+  EXPECT_EQ(grpc_object->data().at("label").string().data(), buffer);
+}
+
+TEST(AstarteTestConversion, FillSharedRvalueKeepsCopies) {
+  GrpcMessageArena arena;
+  const AstarteData blob(std::vector<uint8_t>(256, 0xAB));
+  const AstarteData label(std::string(1024, 'z'));
+  auto* grpc_blob = arena.create<gRPCAstarteData>();
+  GrpcConverterTo::fill(AstarteData(blob), grpc_blob);
+  EXPECT_EQ(grpc_blob->binary_blob(), std::string(256, static_cast<char>(0xAB)));
+  EXPECT_EQ(blob.into<std::vector<uint8_t>>().size(), 256);
+
+  auto* grpc_label = arena.create<gRPCAstarteData>();
+  GrpcConverterTo::fill(AstarteData(label), grpc_label);
+  EXPECT_EQ(grpc_label->string(), std::string(1024, 'z'));
+  EXPECT_NE(grpc_label->string().data(), label.into<std::string_view>().data());
+  EXPECT_EQ(label.into<std::string>(), std::string(1024, 'z'));
+}
+
+TEST(AstarteTestConversion, ConsumingConversionMovesStrings) {
+  GrpcMessageArena arena;
+  auto* grpc_message = arena.create<gRPCAstarteMessage>();
+  grpc_message->set_interface_name("org.astarte.test.ServerDatastreamObject");
+  grpc_message->set_path("/sensors/temperature");
+  AstarteDatastreamObject object = {{"label", AstarteData(std::string(1024, 'y'))},
+                                    {"names", AstarteData(std::vector<std::string>{
+                                                  std::string(64, 'a'), std::string(64, 'b')})}};
+  GrpcConverterTo::fill(object, nullptr, grpc_message->mutable_datastream_object());
+  const char* interface_buffer = grpc_message->interface_name().data();
+  const auto& grpc_data = grpc_message->datastream_object().data();
+  const char* label_buffer = grpc_data.at("label").string().data();
+  const char* name_buffer = grpc_data.at("names").string_array().values(1).data();
+
+  AstarteMessage message = GrpcConverterFrom{}(std::move(*grpc_message)).value();
+  EXPECT_EQ(message.get_interface(), "org.astarte.test.ServerDatastreamObject");
+  EXPECT_EQ(message.get_path(), "/sensors/temperature");
+  EXPECT_EQ(message.into<AstarteDatastreamObject>(), object);
+  EXPECT_EQ(message.get_interface().data(), interface_buffer);
+  const auto& converted = message.into<AstarteDatastreamObject>();
+  EXPECT_EQ(converted.at("label").into<std::string>().data(), label_buffer);
+  EXPECT_EQ(converted.at("names").into<std::vector<std::string>>()[1].data(), name_buffer);
+}
+
+TEST(AstarteTestConversion, ArenaLeaseReusedByThread) {
+  const gRPCAstarteMessage* first = nullptr;
+  {
+    const GrpcArenaLease lease;
+    first = lease->create<gRPCAstarteMessage>();
+    // A nested lease does not share the arena of the outer one
+    const GrpcArenaLease nested;
+    EXPECT_NE(nested.get(), lease.get());
+  }
+  const GrpcArenaLease lease;
+  // The arena has been reset, the same memory is used again
+  EXPECT_EQ(lease->create<gRPCAstarteMessage>(), first);
+  EXPECT_EQ(lease->space_allocated(), GrpcMessageArena::initial_block_size);
+}
@@ -8,6 +8,14 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "astarte_device_sdk/formatter.hpp"
@@ -337,3 +345,97 @@ TEST(AstarteTestData, TryIntoDatetimeArray) {
   auto original = data.try_into<std::vector<std::chrono::system_clock::time_point>>();
   EXPECT_THAT(original.value(), ContainerEq(value));
 }
+
+TEST(AstarteTestData, MoveOutBinaryBlob) {
+  std::vector<uint8_t> value(1024, 0xAB);
+  const uint8_t* buffer = value.data();
+  auto data = AstarteData(std::move(value));
+  EXPECT_EQ(data.into<std::vector<uint8_t>>().data(), buffer);
+  auto original = std::move(data).into<std::vector<uint8_t>>();
+  EXPECT_EQ(original.data(), buffer);
+  EXPECT_EQ(original.size(), 1024);
+}
+
+TEST(AstarteTestData, CopiesSharePayload) {
+  auto data = AstarteData(std::string(256, 'a'));
+  // NOLINTNEXTLINE(performance-unnecessary-copy-initialization)
+  const AstarteData copy = data;
+  EXPECT_EQ(copy.into<std::string_view>().data(), data.into<std::string_view>().data());
+  EXPECT_EQ(copy, data);
+}
+
+TEST(AstarteTestData, MoveOutSharedPayloadCopies) {
+  std::vector<int64_t> value(64, 42);
+  auto data = AstarteData(value);
+  const AstarteData copy = data;
+  auto moved = std::move(data).into<std::vector<int64_t>>();
+  EXPECT_EQ(moved, value);
+  // The payload shared with the copy is left untouched
+  EXPECT_EQ(copy.into<std::vector<int64_t>>(), value);
+  EXPECT_NE(copy.into<std::vector<int64_t>>().data(), moved.data());
+}
+
+TEST(AstarteTestData, VisitWithoutCopies) {
+  auto data = AstarteData(std::vector<std::string>{"a", "b"});
+  const auto* payload = &data.into<std::vector<std::string>>();
+  const bool same = data.visit([payload](const auto& value) {
+    if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::vector<std::string>>) {
+      return &value == payload;
+    } else {
+      return false;
+    }
+  });
+  EXPECT_TRUE(same);
+  EXPECT_EQ(AstarteData(int32_t{3}).visit([](const auto& value) { return sizeof(value); }), 4);
+}
+
+TEST(AstarteTestData, GetIfInPlace) {
+  auto data = AstarteData(std::vector<double>{1.0, 2.0});
+  const auto* values = data.get_if<std::vector<double>>();
+  ASSERT_NE(values, nullptr);
+  EXPECT_EQ(values, &data.into<std::vector<double>>());
+  EXPECT_EQ(data.get_if<std::vector<int64_t>>(), nullptr);
+  const auto scalar = AstarteData(int64_t{7});
+  ASSERT_NE(scalar.get_if<int64_t>(), nullptr);
+  EXPECT_EQ(*scalar.get_if<int64_t>(), 7);
+  EXPECT_EQ(scalar.get_if<int32_t>(), nullptr);
+}
+
+TEST(AstarteTestData, MoveOutAfterCopyReleasedOnOtherThread) {
+  std::vector<int64_t> value(64, 42);
+  const int64_t* buffer = value.data();
+  auto data = AstarteData(std::move(value));
+  auto copy = std::make_unique<AstarteData>(data);
+  std::thread([copy = std::move(copy)]() mutable {
+    EXPECT_EQ(copy->into<std::vector<int64_t>>().size(), 64);
+    copy.reset();
+  }).join();
+  // The copy has been released, the payload is moved instead of copied
+  auto moved = std::move(data).into<std::vector<int64_t>>();
+  EXPECT_EQ(moved.data(), buffer);
+}
+
+TEST(AstarteTestData, GetRawDataInPlace) {
+  auto data = AstarteData(std::string(64, 'a'));
+  const auto* value = std::get_if<std::string>(&data.get_raw_data());
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(value->data(), data.into<std::string_view>().data());
+  const auto scalar = AstarteData(2.5);
+  EXPECT_EQ(std::get<double>(scalar.get_raw_data()), 2.5);
+  EXPECT_EQ(&scalar.get_raw_data(), &scalar.get_raw_data());
+}
+
+TEST(AstarteTestData, TakeMovesSolePayload) {
+  std::vector<int32_t> value(64, 1);
+  const int32_t* buffer = value.data();
+  auto data = AstarteData(std::move(value));
+  auto taken = std::move(data).take();
+  EXPECT_EQ(std::get<std::vector<int32_t>>(taken).data(), buffer);
+
+  auto shared = AstarteData(std::vector<int32_t>(64, 1));
+  const AstarteData copy = shared;
+  auto copied = std::move(shared).take();
+  EXPECT_NE(std::get<std::vector<int32_t>>(copied).data(),
+            copy.into<std::vector<int32_t>>().data());
+  EXPECT_EQ(std::get<std::vector<int32_t>>(copied), copy.into<std::vector<int32_t>>());
+}
@@ -0,0 +1,93 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/data_view.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/type.hpp"
+#include "grpc_arena.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDataView;
+using AstarteDeviceSdk::AstarteType;
+using AstarteDeviceSdk::gRPCAstarteData;
+using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcConverterTo;
+using AstarteDeviceSdk::GrpcMessageArena;
+
+namespace {
+// Serialize the view and convert it back to an owning Astarte data.
+auto round_trip(const AstarteDataView& view) -> AstarteData {
+  GrpcMessageArena arena;
+  auto* grpc_data = arena.create<gRPCAstarteData>();
+  GrpcConverterTo::fill(view, grpc_data);
+  return GrpcConverterFrom{}(*grpc_data).value();
+}
+}  // namespace
+
+TEST(AstarteTestDataView, BinaryBlob) {
+  const std::array<uint8_t, 4> buffer = {0xDE, 0xAD, 0xBE, 0xEF};
+  const AstarteDataView view{std::span<const uint8_t>(buffer)};
+  EXPECT_EQ(view.get_type(), AstarteType::kBinaryBlob);
+  const AstarteData expected(std::vector<uint8_t>(buffer.begin(), buffer.end()));
+  EXPECT_EQ(view.to_data(), expected);
+  EXPECT_EQ(round_trip(view), expected);
+}
+
+TEST(AstarteTestDataView, NumericArrays) {
+  const std::array<double, 3> doubles = {1.5, 2.5, 3.5};
+  const AstarteDataView double_view{std::span<const double>(doubles)};
+  EXPECT_EQ(double_view.get_type(), AstarteType::kDoubleArray);
+  EXPECT_EQ(round_trip(double_view), AstarteData(std::vector<double>{1.5, 2.5, 3.5}));
+
+  const std::vector<int32_t> integers = {1, -2, 3};
+  const AstarteDataView integer_view(integers);
+  EXPECT_EQ(integer_view.get_type(), AstarteType::kIntegerArray);
+  EXPECT_EQ(round_trip(integer_view), AstarteData(integers));
+
+  const std::array<bool, 2> booleans = {true, false};
+  const AstarteDataView boolean_view{std::span<const bool>(booleans)};
+  EXPECT_EQ(boolean_view.get_type(), AstarteType::kBooleanArray);
+  EXPECT_EQ(round_trip(boolean_view), AstarteData(std::vector<bool>{true, false}));
+}
+
+TEST(AstarteTestDataView, StringAndBlobArrays) {
+  const std::array<std::string_view, 2> strings = {"hello", "world"};
+  const AstarteDataView strings_view{std::span<const std::string_view>(strings)};
+  EXPECT_EQ(strings_view.get_type(), AstarteType::kStringArray);
+  const AstarteData expected_strings(std::vector<std::string>{"hello", "world"});
+  EXPECT_EQ(strings_view.to_data(), expected_strings);
+  EXPECT_EQ(round_trip(strings_view), expected_strings);
+
+  const std::array<uint8_t, 2> first = {1, 2};
+  const std::array<uint8_t, 1> second = {3};
+  const std::array<std::span<const uint8_t>, 2> blobs = {std::span<const uint8_t>(first),
+                                                         std::span<const uint8_t>(second)};
+  const AstarteDataView blob_view{std::span<const std::span<const uint8_t>>(blobs)};
+  EXPECT_EQ(blob_view.get_type(), AstarteType::kBinaryBlobArray);
+  const AstarteData expected_blobs(std::vector<std::vector<uint8_t>>{{1, 2}, {3}});
+  EXPECT_EQ(blob_view.to_data(), expected_blobs);
+  EXPECT_EQ(round_trip(blob_view), expected_blobs);
+}
+
+TEST(AstarteTestDataView, DatetimeArray) {
+  const std::vector<std::chrono::system_clock::time_point> timestamps = {
+      std::chrono::system_clock::time_point(std::chrono::seconds(1700000000)),
+      std::chrono::system_clock::time_point(std::chrono::seconds(1700000001))};
+  const AstarteDataView view(timestamps);
+  EXPECT_EQ(view.get_type(), AstarteType::kDatetimeArray);
+  EXPECT_EQ(round_trip(view), AstarteData(timestamps));
+}
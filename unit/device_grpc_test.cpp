@@ -0,0 +1,620 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/device_grpc.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/overflow_policy.hpp"
+#include "astarte_device_sdk/reception_queue.hpp"
+#include "astarte_device_sdk/series.hpp"
+#include "fake_message_hub.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamSeries;
+using AstarteDeviceSdk::AstarteInvalidInputError;
+using AstarteDeviceSdk::AstarteDeviceGrpc;
+using AstarteDeviceSdk::AstarteError;
+using AstarteDeviceSdk::AstarteGrpcLibError;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstarteOperationRefusedError;
+using AstarteDeviceSdk::AstarteOutgoingMessage;
+using AstarteDeviceSdk::AstarteOverflowPolicy;
+using AstarteDeviceSdk::AstarteReceptionQueue;
+using AstarteDeviceSdk::use_awaitable;
+namespace astarte_tl = AstarteDeviceSdk::astarte_tl;
+
+namespace {
+constexpr std::string_view interface_name("org.astarte.test.DeviceDatastream");
+constexpr std::string_view datastream_interface = R"({
+  "interface_name": "org.astarte.test.DeviceDatastream",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/%{sensor}/value", "type": "integer"}]
+})";
+
+constexpr std::string_view long_interface_name("org.astarte.test.DeviceLong");
+constexpr std::string_view long_interface = R"({
+  "interface_name": "org.astarte.test.DeviceLong",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [
+    {"endpoint": "/value", "type": "longinteger"},
+    {"endpoint": "/values", "type": "longintegerarray"},
+    {"endpoint": "/narrow", "type": "integer"}
+  ]
+})";
+
+constexpr std::string_view buffered_interface_name("org.astarte.test.DeviceBuffered");
+constexpr std::string_view buffered_interface = R"({
+  "interface_name": "org.astarte.test.DeviceBuffered",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/value", "type": "integer", "retention": "volatile"}]
+})";
+
+constexpr std::string_view server_interface_name("org.astarte.test.ServerDatastream");
+constexpr std::string_view server_interface = R"({
+  "interface_name": "org.astarte.test.ServerDatastream",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "server",
+  "mappings": [{"endpoint": "/%{sensor}/value", "type": "integer"}]
+})";
+
+auto make_server_message(int32_t value) -> astarteplatform::msghub::AstarteMessage {
+  astarteplatform::msghub::AstarteMessage message;
+  message.set_interface_name(std::string(server_interface_name));
+  message.set_path("/temp/value");
+  message.mutable_datastream_individual()->mutable_data()->set_integer(value);
+  return message;
+}
+
+// Wait for a condition, returning false if it's still unmet after the timeout.
+template <typename Condition>
+auto wait_for(Condition condition, std::chrono::milliseconds timeout = std::chrono::seconds(5))
+    -> bool {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return true;
+}
+
+// Eagerly started coroutine that is never awaited
+struct Task {
+  struct promise_type {
+    auto get_return_object() -> Task { return {}; }
+    auto initial_suspend() -> std::suspend_never { return {}; }
+    auto final_suspend() noexcept -> std::suspend_never { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+auto make_batch(std::size_t count) -> std::vector<AstarteOutgoingMessage> {
+  std::vector<AstarteOutgoingMessage> batch;
+  batch.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    batch.emplace_back(interface_name, "/temp/value",
+                       AstarteDatastreamIndividual(AstarteData(static_cast<int32_t>(i))));
+  }
+  return batch;
+}
+}  // namespace
+
+TEST(AstarteTestDeviceGrpc, DestroyWhileConnected) {
+  FakeMessageHub hub;
+  auto device = std::make_unique<AstarteDeviceGrpc>(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device->add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device->set_outbound_queue(16, AstarteOverflowPolicy::kBlock));
+  ASSERT_TRUE(device->set_message_handler([](const AstarteMessage& /*msg*/) {}));
+  ASSERT_TRUE(device->connect());
+  ASSERT_TRUE(wait_for([&device]() { return device->is_connected(); }));
+  ASSERT_TRUE(device->send_individual(interface_name, "/temp/value", AstarteData(int32_t{1}),
+                                      nullptr));
+
+  // The event stream is cancelled and the connection thread joined by the destructor
+  const auto start = std::chrono::steady_clock::now();
+  device.reset();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+  EXPECT_TRUE(wait_for([&hub]() { return !hub.attached(); }));
+}
+
+TEST(AstarteTestDeviceGrpc, MulticastRefusesPolling) {
+  AstarteDeviceGrpc device("localhost:1", "test-node-uuid");
+  ASSERT_TRUE(device.set_reception_queue(AstarteReceptionQueue::kMulticast));
+  EXPECT_TRUE(device.add_message_consumer());
+
+  auto handle = device.native_handle();
+  ASSERT_FALSE(handle);
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(handle.error()));
+  // Polling returns immediately instead of waiting for messages that never arrive
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(device.poll_incoming(std::chrono::seconds(5)), std::nullopt);
+  std::vector<AstarteMessage> out;
+  EXPECT_EQ(device.poll_incoming_batch(out, 10, std::chrono::seconds(5)), 0U);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+TEST(AstarteTestDeviceGrpc, SetHandlerFromHandler) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(server_interface));
+  std::atomic<int32_t> replaced_value{0};
+  std::atomic<int32_t> subscribed_value{0};
+  ASSERT_TRUE(device.set_message_handler([&](const AstarteMessage& /*msg*/) {
+    // The dispatcher running this handler is replaced without being joined by its own worker
+    EXPECT_TRUE(device.set_message_handler([&](const AstarteMessage& msg) {
+      replaced_value.store(msg.into<AstarteDatastreamIndividual>().get_value().into<int32_t>());
+    }));
+    EXPECT_TRUE(device.subscribe(server_interface_name, "/%{sensor}/value",
+                                 [&](const AstarteMessage& msg) {
+                                   subscribed_value.store(msg.into<AstarteDatastreamIndividual>()
+                                                              .get_value()
+                                                              .into<int32_t>());
+                                 }));
+  }));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  hub.publish(make_server_message(1));
+  hub.publish(make_server_message(2));
+  // The second message is routed to the subscription added by the first handler
+  EXPECT_TRUE(wait_for([&subscribed_value]() { return subscribed_value.load() == 2; }));
+  EXPECT_EQ(replaced_value.load(), 0);
+  // Replacing the handler again from this thread joins the retired dispatcher
+  ASSERT_TRUE(device.set_message_handler(nullptr));
+}
+
+TEST(AstarteTestDeviceGrpc, ReceptionQueueFrozenOnceUsed) {
+  AstarteDeviceGrpc device("localhost:1", "test-node-uuid");
+  ASSERT_TRUE(device.set_reception_queue(AstarteReceptionQueue::kMultiConsumer));
+  ASSERT_TRUE(device.set_reception_queue(AstarteReceptionQueue::kConflating, 8));
+  EXPECT_EQ(device.poll_incoming(std::chrono::milliseconds(0)), std::nullopt);
+  // A queue being polled can't be replaced
+  auto res = device.set_reception_queue(AstarteReceptionQueue::kMultiConsumer);
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(res.error()));
+}
+
+TEST(AstarteTestDeviceGrpc, OutboundQueueCountsFailures) {
+  FakeMessageHub hub;
+  hub.set_fail_sends(true);
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.set_outbound_queue(16, AstarteOverflowPolicy::kBlock));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  // The send succeeds once queued, the failure is only visible through the counter
+  ASSERT_TRUE(device.send_individual(interface_name, "/temp/value", AstarteData(int32_t{1}),
+                                     nullptr));
+  EXPECT_TRUE(wait_for([&device]() { return device.get_failed_messages() == 1; }));
+  EXPECT_EQ(hub.received(), 1U);
+}
+
+TEST(AstarteTestDeviceGrpc, UnparsedInterfaceLeftToMessageHub) {
+  // Unknown mapping types are accepted as before, the message hub decides on their validity
+  constexpr std::string_view unparsed_interface = R"({
+    "interface_name": "org.astarte.test.Unparsed",
+    "version_major": 0,
+    "version_minor": 1,
+    "type": "datastream",
+    "ownership": "device",
+    "mappings": [{"endpoint": "/value", "type": "futuretype"}]
+  })";
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(unparsed_interface));
+  ASSERT_TRUE(device.add_interface_from_str("not a JSON"));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  EXPECT_TRUE(device.send_individual("org.astarte.test.Unparsed", "/value",
+                                     AstarteData(int32_t{1}), nullptr));
+  EXPECT_EQ(hub.received(), 1U);
+  auto res = device.send_individual("org.astarte.test.Missing", "/value", AstarteData(int32_t{1}),
+                                    nullptr);
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(res.error()));
+}
+
+TEST(AstarteTestDeviceGrpc, IntegersWidenedForLongIntegerMappings) {
+  // Validation happens before the connection check, a disconnected device refuses valid messages
+  AstarteDeviceGrpc device("localhost:1", "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(long_interface));
+  auto is_refused = [](const auto& res) {
+    return !res && std::holds_alternative<AstarteOperationRefusedError>(res.error());
+  };
+  auto is_invalid = [](const auto& res) {
+    return !res && std::holds_alternative<AstarteInvalidInputError>(res.error());
+  };
+
+  EXPECT_TRUE(is_refused(
+      device.send_individual(long_interface_name, "/value", AstarteData(int32_t{1}), nullptr)));
+  EXPECT_TRUE(is_refused(device.send_individual(
+      long_interface_name, "/values", AstarteData(std::vector<int32_t>{1, 2}), nullptr)));
+  const auto now = std::chrono::system_clock::now();
+  EXPECT_TRUE(is_refused(device
+                             .send_series(long_interface_name, "/value",
+                                          AstarteDatastreamSeries(std::vector<int32_t>{1}, {now}))
+                             .front()));
+
+  // Long integers are not narrowed for integer mappings
+  EXPECT_TRUE(is_invalid(
+      device.send_individual(long_interface_name, "/narrow", AstarteData(int64_t{1}), nullptr)));
+  EXPECT_TRUE(is_invalid(device
+                             .send_series(long_interface_name, "/narrow",
+                                          AstarteDatastreamSeries(std::vector<int64_t>{1}, {now}))
+                             .front()));
+  EXPECT_TRUE(is_invalid(
+      device.send_individual(long_interface_name, "/value", AstarteData(1.0), nullptr)));
+}
+
+TEST(AstarteTestDeviceGrpc, SendAsync) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  // Refused without a round trip while disconnected
+  auto refused =
+      device.send_individual_async(interface_name, "/temp/value", AstarteData(int32_t{1}), nullptr);
+  ASSERT_EQ(refused.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  auto refused_res = refused.get();
+  ASSERT_FALSE(refused_res);
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(refused_res.error()));
+
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+  auto sent =
+      device.send_individual_async(interface_name, "/temp/value", AstarteData(int32_t{2}), nullptr);
+  ASSERT_EQ(sent.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_TRUE(sent.get());
+  EXPECT_EQ(hub.received(), 1U);
+}
+
+TEST(AstarteTestDeviceGrpc, DestroyWithAsyncSendsInFlight) {
+  FakeMessageHub hub;
+  hub.set_send_delay(std::chrono::milliseconds(100));
+  auto device = std::make_unique<AstarteDeviceGrpc>(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device->add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device->connect());
+  ASSERT_TRUE(wait_for([&device]() { return device->is_connected(); }));
+
+  std::vector<std::future<astarte_tl::expected<void, AstarteError>>> futures;
+  for (int32_t i = 0; i < 4; ++i) {
+    futures.push_back(
+        device->send_individual_async(interface_name, "/temp/value", AstarteData(i), nullptr));
+  }
+  // The completion queue is drained by the destructor, no future is left pending
+  device.reset();
+  for (auto& future : futures) {
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(future.get());
+  }
+}
+
+TEST(AstarteTestDeviceGrpc, ReconnectAfterStreamFailure) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  // The stream closed with an error marks the device disconnected until it attaches again
+  hub.interrupt_stream();
+  ASSERT_TRUE(wait_for([&device]() { return !device.is_connected(); }));
+  ASSERT_TRUE(wait_for([&]() { return (hub.attach_count() == 2) && device.is_connected(); },
+                       std::chrono::seconds(10)));
+  EXPECT_TRUE(device.send_individual(interface_name, "/temp/value", AstarteData(int32_t{1}),
+                                     nullptr));
+  EXPECT_EQ(hub.received(), 1U);
+}
+
+TEST(AstarteTestDeviceGrpc, OutboundQueueResumesAfterReconnection) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.set_outbound_queue(16, AstarteOverflowPolicy::kBlock));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  // The sender thread sleeps while disconnected and is woken up by the new attach
+  hub.interrupt_stream();
+  ASSERT_TRUE(wait_for([&device]() { return !device.is_connected(); }));
+  ASSERT_TRUE(wait_for([&]() { return (hub.attach_count() == 2) && device.is_connected(); },
+                       std::chrono::seconds(10)));
+  ASSERT_TRUE(device.send_individual(interface_name, "/temp/value", AstarteData(int32_t{1}),
+                                     nullptr));
+  EXPECT_TRUE(wait_for([&hub]() { return hub.received() == 1U; }));
+  EXPECT_EQ(device.get_failed_messages(), 0);
+}
+
+TEST(AstarteTestDeviceGrpc, LiveDataNotThrottledByReplay) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(buffered_interface));
+  ASSERT_TRUE(device.set_store_and_forward({.replay_rate = 2}));
+  // Buffered while disconnected, replayed at two messages per second
+  constexpr int32_t backlog = 4;
+  for (int32_t i = 0; i < backlog; ++i) {
+    ASSERT_TRUE(device.send_individual(buffered_interface_name, "/value", AstarteData(i), nullptr));
+  }
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  constexpr int32_t live = 20;
+  const auto start = std::chrono::steady_clock::now();
+  for (int32_t i = 0; i < live; ++i) {
+    ASSERT_TRUE(device.send_individual(buffered_interface_name, "/value", AstarteData(i), nullptr));
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  EXPECT_LT(hub.received(), static_cast<std::uint64_t>(live + backlog));
+  EXPECT_TRUE(wait_for([&hub]() { return hub.received() == live + backlog; }));
+}
+
+TEST(AstarteTestDeviceGrpc, BufferedWhileDisconnectedReplayedInOrder) {
+  FakeMessageHub hub(true);
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(buffered_interface));
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.set_store_and_forward({}));
+  for (int32_t i = 0; i < 3; ++i) {
+    ASSERT_TRUE(device.send_individual(buffered_interface_name, "/value", AstarteData(i), nullptr));
+  }
+  // Mappings with discard retention are not buffered
+  EXPECT_FALSE(
+      device.send_individual(interface_name, "/temp/value", AstarteData(int32_t{1}), nullptr));
+
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&hub]() { return hub.acknowledged() == 3; }));
+  const auto messages = hub.messages();
+  ASSERT_EQ(messages.size(), 3U);
+  for (int32_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(messages[i].datastream_individual().data().integer(), i);
+  }
+}
+
+TEST(AstarteTestDeviceGrpc, FailedSendsStoredForReplay) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(buffered_interface));
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.set_store_and_forward({}));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  // Blocking and asynchronous sends keep the failed datastream, the discarded one is an error
+  hub.set_fail_sends(true);
+  EXPECT_TRUE(device.send_individual(buffered_interface_name, "/value", AstarteData(1), nullptr));
+  EXPECT_TRUE(
+      device.send_individual_async(buffered_interface_name, "/value", AstarteData(2), nullptr)
+          .get());
+  EXPECT_FALSE(
+      device.send_individual(interface_name, "/temp/value", AstarteData(int32_t{3}), nullptr));
+  EXPECT_EQ(hub.acknowledged(), 0U);
+
+  hub.set_fail_sends(false);
+  EXPECT_TRUE(wait_for([&hub]() { return hub.acknowledged() == 2; }));
+}
+
+TEST(AstarteTestDeviceGrpc, BufferedAcrossHubRestart) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(buffered_interface));
+  ASSERT_TRUE(device.set_store_and_forward({}));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  hub.interrupt_stream();
+  ASSERT_TRUE(wait_for([&device]() { return !device.is_connected(); }));
+  for (int32_t i = 0; i < 2; ++i) {
+    ASSERT_TRUE(device.send_individual(buffered_interface_name, "/value", AstarteData(i), nullptr));
+  }
+  EXPECT_EQ(hub.received(), 0U);
+  // Replayed once the device attaches again
+  EXPECT_TRUE(wait_for([&hub]() { return hub.acknowledged() == 2; }, std::chrono::seconds(10)));
+}
+
+TEST(AstarteTestDeviceGrpc, SendBatchResultsInInputOrder) {
+  FakeMessageHub hub(true);
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  auto batch = make_batch(8);
+  batch[3] = AstarteOutgoingMessage("org.astarte.test.Unknown", "/temp/value",
+                                    AstarteDatastreamIndividual(AstarteData(int32_t{3})));
+  const auto results = device.send_batch(batch);
+  ASSERT_EQ(results.size(), 8U);
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(results[i].has_value(), i != 3) << "message " << i;
+  }
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(results[3].error()));
+
+  std::set<int32_t> values;
+  for (const auto& message : hub.messages()) {
+    values.insert(message.datastream_individual().data().integer());
+  }
+  EXPECT_EQ(values, std::set<int32_t>({0, 1, 2, 4, 5, 6, 7}));
+}
+
+TEST(AstarteTestDeviceGrpc, SendBatchBoundsInFlightCalls) {
+  FakeMessageHub hub;
+  hub.set_send_delay(std::chrono::milliseconds(20));
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  const auto results = device.send_batch(make_batch(100));
+  for (const auto& res : results) {
+    EXPECT_TRUE(res);
+  }
+  EXPECT_EQ(hub.acknowledged(), 100U);
+  // Pipelined, but never more than the batch window at once
+  EXPECT_GT(hub.max_in_flight(), 1U);
+  EXPECT_LE(hub.max_in_flight(), 32U);
+}
+
+TEST(AstarteTestDeviceGrpc, SendBatchRefusedOnCompletionThread) {
+  FakeMessageHub hub;
+  // Keep the first send in flight, so that the coroutine is suspended
+  hub.set_send_delay(std::chrono::milliseconds(50));
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  // The coroutine is resumed on the completion thread, where a batch would wait for itself
+  std::promise<std::vector<astarte_tl::expected<void, AstarteError>>> done;
+  [](AstarteDeviceGrpc& device,
+     std::promise<std::vector<astarte_tl::expected<void, AstarteError>>>& done) -> Task {
+    auto sent = co_await device.send_individual_async(
+        interface_name, "/temp/value", AstarteData(int32_t{1}), nullptr, use_awaitable);
+    EXPECT_TRUE(sent);
+    done.set_value(device.send_batch(make_batch(2)));
+  }(device, done);
+  auto results = done.get_future();
+  ASSERT_EQ(results.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  for (const auto& res : results.get()) {
+    ASSERT_FALSE(res);
+    EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(res.error()));
+  }
+}
+
+TEST(AstarteTestDeviceGrpc, SendSeriesTransmitsEverySample) {
+  FakeMessageHub hub(true);
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(long_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  const auto start = std::chrono::system_clock::now();
+  AstarteDatastreamSeries series(std::vector<int64_t>{}, {});
+  for (int64_t i = 0; i < 50; ++i) {
+    series.push_back(i, start + std::chrono::milliseconds(i));
+  }
+  const auto results = device.send_series(long_interface_name, "/value", series);
+  ASSERT_EQ(results.size(), 50U);
+  for (const auto& res : results) {
+    EXPECT_TRUE(res);
+  }
+
+  auto messages = hub.messages();
+  ASSERT_EQ(messages.size(), 50U);
+  std::set<int64_t> values;
+  for (const auto& message : messages) {
+    EXPECT_EQ(message.path(), "/value");
+    EXPECT_TRUE(message.datastream_individual().has_timestamp());
+    values.insert(message.datastream_individual().data().long_integer());
+  }
+  EXPECT_EQ(values.size(), 50U);
+  EXPECT_EQ(*values.begin(), 0);
+  EXPECT_EQ(*values.rbegin(), 49);
+}
+
+TEST(AstarteTestDeviceGrpc, SendSeriesReportsEachSample) {
+  FakeMessageHub hub;
+  hub.set_fail_sends(true);
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(long_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  const auto now = std::chrono::system_clock::now();
+  AstarteDatastreamSeries series(std::vector<int64_t>{}, {});
+  for (int64_t i = 0; i < 200; ++i) {
+    series.push_back(i, now);
+  }
+  const auto results = device.send_series(long_interface_name, "/value", series);
+  ASSERT_EQ(results.size(), 200U);
+  // The first sample fails, submission stops once the failure is known
+  ASSERT_FALSE(results.front());
+  EXPECT_TRUE(std::holds_alternative<AstarteGrpcLibError>(results.front().error()));
+  ASSERT_FALSE(results.back());
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(results.back().error()));
+  // Every sample that reached the hub reports its own failure
+  const auto transmitted = std::count_if(results.begin(), results.end(), [](const auto& res) {
+    return std::holds_alternative<AstarteGrpcLibError>(res.error());
+  });
+  EXPECT_EQ(hub.received(), static_cast<std::uint64_t>(transmitted));
+}
+
+TEST(AstarteTestDeviceGrpc, DecodeWorkersKeepPathOrder) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(server_interface));
+  ASSERT_TRUE(device.set_decode_workers(2));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  // More events than the decode queues hold, so the arenas of the events are recycled
+  constexpr int32_t count = 500;
+  for (int32_t i = 0; i < count; ++i) {
+    hub.publish(make_server_message(i));
+  }
+  std::vector<int32_t> values;
+  while (values.size() < count) {
+    auto msg = device.poll_incoming(std::chrono::seconds(5));
+    ASSERT_TRUE(msg.has_value());
+    values.push_back(msg->into<AstarteDatastreamIndividual>().get_value().into<int32_t>());
+  }
+  for (int32_t i = 0; i < count; ++i) {
+    EXPECT_EQ(values[static_cast<std::size_t>(i)], i);
+  }
+}
+
+TEST(AstarteTestDeviceGrpc, ReceivedMessagesShareInterfaceName) {
+  FakeMessageHub hub;
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(server_interface));
+  ASSERT_TRUE(device.connect());
+  ASSERT_TRUE(wait_for([&device]() { return device.is_connected(); }));
+
+  hub.publish(make_server_message(1));
+  hub.publish(make_server_message(2));
+  auto first = device.poll_incoming(std::chrono::seconds(5));
+  auto second = device.poll_incoming(std::chrono::seconds(5));
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_TRUE(first->get_interface_handle().shares(second->get_interface_handle()));
+  EXPECT_EQ(first->get_interface(), server_interface_name);
+  // Parametric paths are owned by each message
+  EXPECT_FALSE(first->get_path_handle().shares(second->get_path_handle()));
+  EXPECT_EQ(first->get_path(), "/temp/value");
+}
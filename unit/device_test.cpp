@@ -0,0 +1,186 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/device.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/data_view.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/outgoing_msg.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/series.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDataView;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteDatastreamSeries;
+using AstarteDeviceSdk::AstarteDevice;
+using AstarteDeviceSdk::AstarteError;
+using AstarteDeviceSdk::AstarteInvalidInputError;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstarteOperationRefusedError;
+using AstarteDeviceSdk::AstarteOutgoingMessage;
+using AstarteDeviceSdk::AstartePropertyIndividual;
+namespace astarte_tl = AstarteDeviceSdk::astarte_tl;
+
+namespace {
+
+// Device implementing only the functions of the first release, as done outside of the SDK
+class RecordingDevice : public AstarteDevice {
+ public:
+  auto add_interface_from_file(const std::filesystem::path& /*json_file*/)
+      -> astarte_tl::expected<void, AstarteError> override {
+    return {};
+  }
+  auto add_interface_from_str(std::string_view /*json*/)
+      -> astarte_tl::expected<void, AstarteError> override {
+    return {};
+  }
+  auto remove_interface(const std::string& /*interface_name*/)
+      -> astarte_tl::expected<void, AstarteError> override {
+    return {};
+  }
+  auto connect() -> astarte_tl::expected<void, AstarteError> override { return {}; }
+  [[nodiscard]] auto is_connected() const -> bool override { return true; }
+  auto disconnect() -> astarte_tl::expected<void, AstarteError> override { return {}; }
+  auto send_individual(std::string_view /*interface_name*/, std::string_view path,
+                       const AstarteData& data,
+                       const std::chrono::system_clock::time_point* timestamp)
+      -> astarte_tl::expected<void, AstarteError> override {
+    if (path == "/fail") {
+      return astarte_tl::unexpected(AstarteInvalidInputError{"Failing path."});
+    }
+    sent.push_back(data);
+    timestamps.push_back(timestamp != nullptr ? std::optional(*timestamp) : std::nullopt);
+    return {};
+  }
+  auto send_object(std::string_view /*interface_name*/, std::string_view /*path*/,
+                   const AstarteDatastreamObject& object,
+                   const std::chrono::system_clock::time_point* /*timestamp*/)
+      -> astarte_tl::expected<void, AstarteError> override {
+    objects.push_back(object);
+    return {};
+  }
+  auto set_property(std::string_view /*interface_name*/, std::string_view /*path*/,
+                    const AstarteData& data) -> astarte_tl::expected<void, AstarteError> override {
+    properties.emplace_back(data);
+    return {};
+  }
+  auto unset_property(std::string_view /*interface_name*/, std::string_view /*path*/)
+      -> astarte_tl::expected<void, AstarteError> override {
+    properties.emplace_back(std::nullopt);
+    return {};
+  }
+  auto poll_incoming(const std::chrono::milliseconds& /*timeout*/)
+      -> std::optional<AstarteMessage> override {
+    if (incoming.empty()) {
+      return std::nullopt;
+    }
+    AstarteMessage message = incoming.front();
+    incoming.pop_front();
+    return message;
+  }
+
+  std::vector<AstarteData> sent;
+  std::vector<std::optional<std::chrono::system_clock::time_point>> timestamps;
+  std::vector<AstarteDatastreamObject> objects;
+  std::vector<std::optional<AstarteData>> properties;
+  std::deque<AstarteMessage> incoming;
+};
+
+}  // namespace
+
+TEST(AstarteTestDevice, DefaultOverloadsForward) {
+  RecordingDevice device;
+  AstarteDevice& base = device;
+  ASSERT_TRUE(base.send_individual("org.astarte.test", "/value", AstarteData(1), nullptr));
+  const std::vector<int32_t> values{2, 3};
+  ASSERT_TRUE(base.send_individual("org.astarte.test", "/value", AstarteDataView(values), nullptr));
+  ASSERT_TRUE(base.send_object("org.astarte.test", "/object",
+                               AstarteDatastreamObject{{"a", AstarteData(4)}}, nullptr));
+  ASSERT_TRUE(base.set_property("org.astarte.test", "/property", AstarteData(5)));
+
+  EXPECT_EQ(device.sent, (std::vector<AstarteData>{AstarteData(1), AstarteData(values)}));
+  ASSERT_EQ(device.objects.size(), 1);
+  EXPECT_EQ(device.objects[0].at("a"), AstarteData(4));
+  EXPECT_EQ(device.properties, (std::vector<std::optional<AstarteData>>{AstarteData(5)}));
+}
+
+TEST(AstarteTestDevice, DefaultBatchSendsEachMessage) {
+  RecordingDevice device;
+  AstarteDevice& base = device;
+  const auto timestamp = std::chrono::system_clock::now();
+  const std::vector<AstarteOutgoingMessage> messages{
+      {"org.astarte.test", "/value", AstarteDatastreamIndividual(AstarteData(1)), timestamp},
+      {"org.astarte.test", "/fail", AstarteDatastreamIndividual(AstarteData(2))},
+      {"org.astarte.test", "/object", AstarteDatastreamObject{{"a", AstarteData(3)}}},
+      {"org.astarte.test", "/property", AstartePropertyIndividual(AstarteData(4))},
+      {"org.astarte.test", "/property", AstartePropertyIndividual(std::nullopt)}};
+
+  auto results = base.send_batch(messages);
+  ASSERT_EQ(results.size(), messages.size());
+  EXPECT_TRUE(results[0]);
+  EXPECT_FALSE(results[1]);
+  EXPECT_TRUE(results[2]);
+  EXPECT_TRUE(results[3]);
+  EXPECT_TRUE(results[4]);
+  EXPECT_EQ(device.timestamps, (std::vector<std::optional<std::chrono::system_clock::time_point>>{
+                                   timestamp}));
+  EXPECT_EQ(device.objects.size(), 1);
+  EXPECT_EQ(device.properties,
+            (std::vector<std::optional<AstarteData>>{AstarteData(4), std::nullopt}));
+}
+
+TEST(AstarteTestDevice, DefaultSeriesStopsAtFailure) {
+  RecordingDevice device;
+  AstarteDevice& base = device;
+  const auto now = std::chrono::system_clock::now();
+  const AstarteDatastreamSeries series(std::vector<int32_t>{1, 2},
+                                       {now, now + std::chrono::seconds(1)});
+
+  auto results = base.send_series("org.astarte.test", "/value", series);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_TRUE(results[0]);
+  EXPECT_TRUE(results[1]);
+  EXPECT_EQ(device.sent, (std::vector<AstarteData>{AstarteData(1), AstarteData(2)}));
+  EXPECT_EQ(device.timestamps[1], now + std::chrono::seconds(1));
+
+  results = base.send_series("org.astarte.test", "/fail", series);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(results[0].error()));
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(results[1].error()));
+}
+
+TEST(AstarteTestDevice, DefaultPollBatch) {
+  RecordingDevice device;
+  AstarteDevice& base = device;
+  for (int32_t i = 0; i < 3; ++i) {
+    device.incoming.emplace_back("org.astarte.test", "/value",
+                                 AstarteDatastreamIndividual(AstarteData(i)));
+  }
+
+  std::vector<AstarteMessage> out;
+  EXPECT_EQ(base.poll_incoming_batch(out, 2, std::chrono::milliseconds(0)), 2);
+  EXPECT_EQ(base.poll_incoming_batch(out, 2, std::chrono::milliseconds(0)), 1);
+  EXPECT_EQ(base.poll_incoming_batch(out, 2, std::chrono::milliseconds(0)), 0);
+  ASSERT_EQ(out.size(), 3);
+  EXPECT_EQ(out[2].into<AstarteDatastreamIndividual>().get_value(), AstarteData(2));
+}
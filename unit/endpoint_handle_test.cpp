@@ -0,0 +1,179 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/endpoint_handle.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "fake_message_hub.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteDeviceGrpc;
+using AstarteDeviceSdk::AstarteInvalidInputError;
+using AstarteDeviceSdk::AstarteOperationRefusedError;
+
+namespace {
+constexpr std::string_view datastream_interface = R"({
+  "interface_name": "org.astarte.test.DeviceDatastream",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [
+    {"endpoint": "/%{sensor}/value", "type": "integer"},
+    {"endpoint": "/%{sensor}/samples", "type": "integerarray"}
+  ]
+})";
+
+constexpr std::string_view server_interface = R"({
+  "interface_name": "org.astarte.test.ServerDatastream",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "server",
+  "mappings": [{"endpoint": "/value", "type": "integer"}]
+})";
+
+class AstarteTestEndpointHandle : public testing::Test {
+ protected:
+  void SetUp() override {
+    device_ = std::make_unique<AstarteDeviceGrpc>("localhost:1", "test-node-uuid");
+    ASSERT_TRUE(device_->add_interface_from_str(datastream_interface));
+    ASSERT_TRUE(device_->add_interface_from_str(server_interface));
+  }
+
+  std::unique_ptr<AstarteDeviceGrpc> device_;
+};
+}  // namespace
+
+TEST_F(AstarteTestEndpointHandle, PrepareValidEndpoint) {
+  auto handle = device_->prepare("org.astarte.test.DeviceDatastream", "/temp/value");
+  ASSERT_TRUE(handle);
+  EXPECT_EQ(handle->get_interface(), "org.astarte.test.DeviceDatastream");
+  EXPECT_EQ(handle->get_path(), "/temp/value");
+}
+
+TEST_F(AstarteTestEndpointHandle, PrepareUnknownInterface) {
+  auto handle = device_->prepare("org.astarte.test.Unknown", "/value");
+  ASSERT_FALSE(handle);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(handle.error()));
+}
+
+TEST_F(AstarteTestEndpointHandle, PrepareServerOwnedInterface) {
+  auto handle = device_->prepare("org.astarte.test.ServerDatastream", "/value");
+  ASSERT_FALSE(handle);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(handle.error()));
+}
+
+TEST_F(AstarteTestEndpointHandle, PrepareUnmatchedPath) {
+  auto handle = device_->prepare("org.astarte.test.DeviceDatastream", "/temp/other");
+  ASSERT_FALSE(handle);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(handle.error()));
+}
+
+TEST_F(AstarteTestEndpointHandle, SendUnsupportedOperation) {
+  auto handle = device_->prepare("org.astarte.test.DeviceDatastream", "/temp/value");
+  ASSERT_TRUE(handle);
+  auto res = handle->set_property(AstarteData(int32_t{1}));
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(res.error()));
+  res = handle->send_object(AstarteDatastreamObject(), nullptr);
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(res.error()));
+}
+
+TEST_F(AstarteTestEndpointHandle, SendWhileDisconnected) {
+  auto handle = device_->prepare("org.astarte.test.DeviceDatastream", "/temp/value");
+  ASSERT_TRUE(handle);
+  EXPECT_FALSE(handle->send_individual(AstarteData(int32_t{42}), nullptr));
+}
+
+TEST_F(AstarteTestEndpointHandle, SendAfterDeviceDestroyed) {
+  auto handle = device_->prepare("org.astarte.test.DeviceDatastream", "/temp/value");
+  ASSERT_TRUE(handle);
+  device_.reset();
+  auto res = handle->send_individual(AstarteData(int32_t{42}), nullptr);
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(res.error()));
+}
+
+TEST_F(AstarteTestEndpointHandle, SendAfterInterfaceRemoved) {
+  auto handle = device_->prepare("org.astarte.test.DeviceDatastream", "/temp/value");
+  ASSERT_TRUE(handle);
+  ASSERT_TRUE(device_->remove_interface("org.astarte.test.DeviceDatastream"));
+  auto res = handle->send_individual(AstarteData(int32_t{42}), nullptr);
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(res.error()));
+
+  // Adding the interface back validates the endpoint again, the send reaches the connection check
+  ASSERT_TRUE(device_->add_interface_from_str(datastream_interface));
+  res = handle->send_individual(AstarteData(int32_t{42}), nullptr);
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteOperationRefusedError>(res.error()));
+}
+
+TEST(AstarteTestEndpointHandleSend, RepeatedArraySends) {
+  FakeMessageHub hub(true);
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.connect());
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!device.is_connected() && (std::chrono::steady_clock::now() < deadline)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_TRUE(device.is_connected());
+
+  auto handle = device.prepare("org.astarte.test.DeviceDatastream", "/temp/samples");
+  ASSERT_TRUE(handle);
+  // The message cached by the handle is refilled by each send
+  ASSERT_TRUE(handle->send_individual(AstarteData(std::vector<int32_t>{1, 2, 3}), nullptr));
+  ASSERT_TRUE(handle->send_individual(AstarteData(std::vector<int32_t>{4, 5}), nullptr));
+
+  const auto messages = hub.messages();
+  ASSERT_EQ(messages.size(), 2U);
+  const auto& values = messages[1].datastream_individual().data().integer_array().values();
+  EXPECT_EQ(std::vector<int32_t>(values.begin(), values.end()), std::vector<int32_t>({4, 5}));
+  EXPECT_TRUE(device.disconnect());
+}
+
+TEST(AstarteTestEndpointHandleSend, ConcurrentSendsNotSerialized) {
+  FakeMessageHub hub;
+  hub.set_send_delay(std::chrono::milliseconds(200));
+  AstarteDeviceGrpc device(hub.address(), "test-node-uuid");
+  ASSERT_TRUE(device.add_interface_from_str(datastream_interface));
+  ASSERT_TRUE(device.connect());
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!device.is_connected() && (std::chrono::steady_clock::now() < deadline)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_TRUE(device.is_connected());
+
+  auto handle = device.prepare("org.astarte.test.DeviceDatastream", "/temp/value");
+  ASSERT_TRUE(handle);
+  // The lock of the handle is not held while the message hub answers
+  std::vector<std::thread> senders;
+  for (int32_t i = 0; i < 2; ++i) {
+    senders.emplace_back([&handle, i]() {
+      EXPECT_TRUE(handle->send_individual(AstarteData(i), nullptr));
+    });
+  }
+  for (auto& sender : senders) {
+    sender.join();
+  }
+  EXPECT_EQ(hub.acknowledged(), 2U);
+  EXPECT_EQ(hub.max_in_flight(), 2U);
+  EXPECT_TRUE(device.disconnect());
+}
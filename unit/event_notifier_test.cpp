@@ -0,0 +1,38 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "event_notifier.hpp"
+
+#include <gtest/gtest.h>
+#include <poll.h>
+
+#include <memory>
+
+using AstarteDeviceSdk::EventNotifier;
+
+namespace {
+auto is_readable(int fd) -> bool {
+  pollfd pfd{.fd = fd, .events = POLLIN, .revents = 0};
+  return (poll(&pfd, 1, 0) == 1) && ((pfd.revents & POLLIN) != 0);
+}
+}  // namespace
+
+TEST(AstarteTestEventNotifier, SignalAndClear) {
+  auto notifier = EventNotifier::create();
+  ASSERT_TRUE(notifier);
+  const int fd = notifier.value()->native_handle();
+  EXPECT_GE(fd, 0);
+  EXPECT_FALSE(is_readable(fd));
+
+  notifier.value()->signal();
+  notifier.value()->signal();
+  EXPECT_TRUE(is_readable(fd));
+
+  notifier.value()->clear();
+  EXPECT_FALSE(is_readable(fd));
+
+  // Clearing a non signaled notifier is harmless
+  notifier.value()->clear();
+  EXPECT_FALSE(is_readable(fd));
+}
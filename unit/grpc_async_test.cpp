@@ -0,0 +1,106 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "grpc_async.hpp"
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/errors.hpp"
+#include "fake_message_hub.hpp"
+
+using AstarteDeviceSdk::AstarteError;
+using AstarteDeviceSdk::AstarteGrpcLibError;
+using AstarteDeviceSdk::GrpcAsyncSendCall;
+using AstarteDeviceSdk::GrpcCompletionQueueThread;
+using AstarteDeviceSdk::gRPCAstarteMessage;
+using AstarteDeviceSdk::gRPCMessageHub;
+namespace astarte_tl = AstarteDeviceSdk::astarte_tl;
+
+namespace {
+auto make_stub(const std::string& address) -> std::unique_ptr<gRPCMessageHub::Stub> {
+  return gRPCMessageHub::NewStub(
+      grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+}
+
+auto make_message() -> gRPCAstarteMessage {
+  gRPCAstarteMessage message;
+  message.set_interface_name("org.astarte.test.DeviceDatastream");
+  message.set_path("/temp/value");
+  message.mutable_datastream_individual()->mutable_data()->set_integer(1);
+  return message;
+}
+
+// Start a send, returning a future holding the result passed to the callback.
+auto start_send(gRPCMessageHub::Stub* stub, GrpcCompletionQueueThread& cq_thread)
+    -> std::future<astarte_tl::expected<void, AstarteError>> {
+  auto promise = std::make_shared<std::promise<astarte_tl::expected<void, AstarteError>>>();
+  auto future = promise->get_future();
+  GrpcAsyncSendCall::start(stub, cq_thread.queue(), make_message(),
+                           [promise](astarte_tl::expected<void, AstarteError> res) {
+                             promise->set_value(std::move(res));
+                           });
+  return future;
+}
+}  // namespace
+
+TEST(AstarteTestGrpcAsync, SendCompletes) {
+  FakeMessageHub hub(true);
+  auto stub = make_stub(hub.address());
+  GrpcCompletionQueueThread cq_thread;
+
+  auto future = start_send(stub.get(), cq_thread);
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+  ASSERT_EQ(hub.messages().size(), 1U);
+  EXPECT_EQ(hub.messages()[0].path(), "/temp/value");
+}
+
+TEST(AstarteTestGrpcAsync, ConnectionRefused) {
+  // Nothing listens on the port, the call fails instead of waiting for the server
+  auto stub = make_stub("127.0.0.1:1");
+  GrpcCompletionQueueThread cq_thread;
+
+  auto future = start_send(stub.get(), cq_thread);
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  auto res = future.get();
+  ASSERT_FALSE(res);
+  EXPECT_TRUE(std::holds_alternative<AstarteGrpcLibError>(res.error()));
+}
+
+TEST(AstarteTestGrpcAsync, ShutdownWithCallsInFlight) {
+  constexpr std::size_t calls = 8;
+  FakeMessageHub hub;
+  hub.set_send_delay(std::chrono::milliseconds(100));
+  auto stub = make_stub(hub.address());
+  std::atomic<std::size_t> completed{0};
+  std::atomic<std::size_t> succeeded{0};
+  {
+    GrpcCompletionQueueThread cq_thread;
+    for (std::size_t i = 0; i < calls; ++i) {
+      GrpcAsyncSendCall::start(stub.get(), cq_thread.queue(), make_message(),
+                               [&completed, &succeeded](auto res) {
+                                 if (res) {
+                                   succeeded.fetch_add(1);
+                                 }
+                                 completed.fetch_add(1);
+                               });
+    }
+    // The destructor drains the queue, every pending call completes before it returns
+  }
+  EXPECT_EQ(completed.load(), calls);
+  EXPECT_EQ(succeeded.load(), calls);
+  EXPECT_EQ(hub.received(), calls);
+}
@@ -0,0 +1,145 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "interface.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string_view>
+
+#include "astarte_device_sdk/interned_string.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/type.hpp"
+
+using AstarteDeviceSdk::AstarteAggregation;
+using AstarteDeviceSdk::AstarteInterface;
+using AstarteDeviceSdk::AstarteInternedString;
+using AstarteDeviceSdk::AstarteInterfaceType;
+using AstarteDeviceSdk::AstarteOwnership;
+using AstarteDeviceSdk::AstarteRetention;
+using AstarteDeviceSdk::AstarteType;
+
+namespace {
+constexpr std::string_view individual_json = R"({
+  "interface_name": "org.astarte.test.Individual",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [
+    {"endpoint": "/%{sensor}/value", "type": "double", "retention": "stored", "expiry": 60,
+     "explicit_timestamp": true},
+    {"endpoint": "/status", "type": "string"}
+  ]
+})";
+
+constexpr std::string_view object_json = R"({
+  "interface_name": "org.astarte.test.Object",
+  "version_major": 1,
+  "version_minor": 0,
+  "type": "datastream",
+  "ownership": "device",
+  "aggregation": "object",
+  "mappings": [
+    {"endpoint": "/%{sensor}/a", "type": "integer", "retention": "volatile"},
+    {"endpoint": "/%{sensor}/b", "type": "integer", "retention": "volatile"}
+  ]
+})";
+}  // namespace
+
+TEST(AstarteTestInterface, ParseIndividual) {
+  auto interface = AstarteInterface::create(individual_json);
+  ASSERT_TRUE(interface);
+  EXPECT_EQ(interface->name(), "org.astarte.test.Individual");
+  EXPECT_EQ(interface->version_major(), 0);
+  EXPECT_EQ(interface->version_minor(), 1);
+  EXPECT_EQ(interface->type(), AstarteInterfaceType::kDatastream);
+  EXPECT_EQ(interface->ownership(), AstarteOwnership::kDevice);
+  EXPECT_EQ(interface->aggregation(), AstarteAggregation::kIndividual);
+  ASSERT_EQ(interface->mappings().size(), 2);
+
+  const auto* mapping = interface->find_mapping("/temp/value");
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(mapping->type, AstarteType::kDouble);
+  EXPECT_EQ(mapping->retention, AstarteRetention::kStored);
+  EXPECT_EQ(mapping->expiry, std::chrono::seconds(60));
+  EXPECT_TRUE(mapping->explicit_timestamp);
+
+  mapping = interface->find_mapping("/status");
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(mapping->retention, AstarteRetention::kDiscard);
+  EXPECT_EQ(mapping->expiry, std::chrono::seconds(0));
+
+  EXPECT_EQ(interface->find_mapping("/temp"), nullptr);
+  EXPECT_EQ(interface->find_mapping("//value"), nullptr);
+  EXPECT_EQ(interface->find_mapping("/temp/value/extra"), nullptr);
+}
+
+TEST(AstarteTestInterface, ParseObject) {
+  auto interface = AstarteInterface::create(object_json);
+  ASSERT_TRUE(interface);
+  EXPECT_EQ(interface->aggregation(), AstarteAggregation::kObject);
+  const auto* mapping = interface->find_mapping("/sensor1");
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(mapping->retention, AstarteRetention::kVolatile);
+  EXPECT_EQ(interface->find_mapping("/sensor1/a"), nullptr);
+
+  mapping = interface->find_object_field("/sensor1", "b");
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_EQ(mapping->endpoint, "/%{sensor}/b");
+  EXPECT_EQ(interface->find_object_field("/sensor1", "c"), nullptr);
+  EXPECT_EQ(interface->find_object_field("/sensor1/a", "b"), nullptr);
+}
+
+TEST(AstarteTestInterface, LiteralSegmentsTakePrecedence) {
+  auto interface = AstarteInterface::create(R"({
+    "interface_name": "org.astarte.test.Overlap", "version_major": 0, "version_minor": 1,
+    "type": "datastream", "ownership": "device",
+    "mappings": [
+      {"endpoint": "/%{sensor}/value", "type": "double"},
+      {"endpoint": "/status/value", "type": "string"},
+      {"endpoint": "/status/%{field}/raw", "type": "integer"}
+    ]
+  })");
+  ASSERT_TRUE(interface);
+  EXPECT_EQ(interface->find_mapping("/status/value")->type, AstarteType::kString);
+  EXPECT_EQ(interface->find_mapping("/other/value")->type, AstarteType::kDouble);
+  // The literal segment leads nowhere, the parameter is tried next
+  EXPECT_EQ(interface->find_mapping("/status/value/raw")->type, AstarteType::kInteger);
+  EXPECT_EQ(interface->find_object_field("/status", "value"), nullptr);
+}
+
+TEST(AstarteTestInterface, SharedNames) {
+  auto interface = AstarteInterface::create(individual_json);
+  ASSERT_TRUE(interface);
+  const AstarteInterface copy = interface.value();
+
+  const AstarteInternedString name = interface->name_handle();
+  EXPECT_EQ(name.get(), "org.astarte.test.Individual");
+  EXPECT_TRUE(name.shares(copy.name_handle()));
+  EXPECT_TRUE(interface->path_handle("/status").shares(copy.path_handle("/status")));
+  // Parametric paths are owned by each handle
+  const AstarteInternedString path = interface->path_handle("/temp/value");
+  EXPECT_EQ(path.get(), "/temp/value");
+  EXPECT_FALSE(path.shares(interface->path_handle("/temp/value")));
+}
+
+TEST(AstarteTestInterface, ParseInvalid) {
+  EXPECT_FALSE(AstarteInterface::create("not a json"));
+  EXPECT_FALSE(AstarteInterface::create(R"({"interface_name": "org.astarte.test.Missing"})"));
+  EXPECT_FALSE(AstarteInterface::create(R"({
+    "interface_name": "org.astarte.test.Invalid", "version_major": 0, "version_minor": 1,
+    "type": "datastream", "ownership": "device",
+    "mappings": [{"endpoint": "/value", "type": "double", "retention": "forever"}]
+  })"));
+}
+
+TEST(AstarteTestInterface, ParseNameOfInvalid) {
+  EXPECT_EQ(AstarteInterface::parse_name(R"({"interface_name": "org.astarte.test.Missing"})"),
+            "org.astarte.test.Missing");
+  EXPECT_FALSE(AstarteInterface::parse_name("not a json"));
+  EXPECT_FALSE(AstarteInterface::parse_name(R"({"interface_name": 1})"));
+}
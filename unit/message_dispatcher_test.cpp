@@ -0,0 +1,158 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "message_dispatcher.hpp"
+#include "shared_queue.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::MessageDispatcher;
+using AstarteDeviceSdk::SharedQueue;
+
+namespace {
+auto make_message(int32_t value) -> AstarteMessage {
+  return {"org.astarte.test.ServerDatastream", "/value",
+          AstarteDatastreamIndividual(AstarteData(value))};
+}
+
+auto message_value(const AstarteMessage& message) -> int32_t {
+  return message.into<AstarteDatastreamIndividual>().get_value().into<int32_t>();
+}
+
+// Wait until the condition holds or the timeout expires.
+template <typename Pred>
+auto wait_until(Pred pred) -> bool {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!pred()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+}  // namespace
+
+TEST(AstarteTestMessageDispatcher, SingleWorkerKeepsOrder) {
+  SharedQueue<AstarteMessage> queue;
+  std::mutex mutex;
+  std::vector<int32_t> received;
+  MessageDispatcher dispatcher(
+      queue,
+      [&](const AstarteMessage& message) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(message_value(message));
+      },
+      1);
+
+  for (int32_t i = 0; i < 100; ++i) {
+    queue.push(make_message(i));
+  }
+  ASSERT_TRUE(wait_until([&] {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return received.size() == 100;
+  }));
+  for (int32_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(received[i], i);
+  }
+}
+
+TEST(AstarteTestMessageDispatcher, MultipleWorkersDeliverAll) {
+  SharedQueue<AstarteMessage> queue;
+  std::mutex mutex;
+  std::set<int32_t> received;
+  std::set<std::thread::id> threads;
+  MessageDispatcher dispatcher(
+      queue,
+      [&](const AstarteMessage& message) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const std::lock_guard<std::mutex> lock(mutex);
+        received.insert(message_value(message));
+        threads.insert(std::this_thread::get_id());
+      },
+      4);
+
+  for (int32_t i = 0; i < 200; ++i) {
+    queue.push(make_message(i));
+  }
+  ASSERT_TRUE(wait_until([&] {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return received.size() == 200;
+  }));
+  EXPECT_GT(threads.size(), 1);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(AstarteTestMessageDispatcher, ThrowingHandlerDoesNotStopWorker) {
+  SharedQueue<AstarteMessage> queue;
+  std::atomic_int handled{0};
+  MessageDispatcher dispatcher(
+      queue,
+      [&](const AstarteMessage& message) {
+        handled++;
+        if (message_value(message) == 0) {
+          throw std::runtime_error("handler failure");
+        }
+      },
+      1);
+
+  queue.push(make_message(0));
+  queue.push(make_message(1));
+  EXPECT_TRUE(wait_until([&] { return handled.load() == 2; }));
+}
+
+TEST(AstarteTestMessageDispatcher, DestructionLeavesQueuedMessages) {
+  SharedQueue<AstarteMessage> queue;
+  {
+    MessageDispatcher dispatcher(queue, [](const AstarteMessage&) {}, 2);
+  }
+  queue.push(make_message(0));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(queue.size(), 1);
+}
+
+TEST(AstarteTestMessageDispatcher, StopRequestedFromWorker) {
+  SharedQueue<AstarteMessage> queue;
+  std::atomic<MessageDispatcher*> self{nullptr};
+  std::atomic_bool on_worker{false};
+  std::atomic_int handled{0};
+  auto dispatcher = std::make_unique<MessageDispatcher>(
+      queue,
+      [&](const AstarteMessage& /*message*/) {
+        // A worker can stop its own dispatcher, the join is left to another thread
+        on_worker.store(self.load()->runs_on_current_thread());
+        self.load()->request_stop();
+        handled.fetch_add(1);
+      },
+      1);
+  self.store(dispatcher.get());
+  EXPECT_FALSE(dispatcher->runs_on_current_thread());
+
+  queue.push(make_message(1));
+  ASSERT_TRUE(wait_until([&] { return handled.load() == 1; }));
+  EXPECT_TRUE(on_worker.load());
+  // The stopped worker no longer consumes messages
+  queue.push(make_message(2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_EQ(handled.load(), 1);
+  EXPECT_EQ(queue.size(), 1U);
+  dispatcher.reset();
+}
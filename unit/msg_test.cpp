@@ -7,9 +7,12 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "astarte_device_sdk/interned_string.hpp"
+
 using AstarteDeviceSdk::AstarteData;
 using AstarteDeviceSdk::AstarteDatastreamIndividual;
 using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteInternedString;
 using AstarteDeviceSdk::AstarteMessage;
 using AstarteDeviceSdk::AstartePropertyIndividual;
 
@@ -64,3 +67,18 @@ TEST(AstarteTestMessage, InstantiationPropertyIndividual) {
   EXPECT_EQ(msg.try_into<AstartePropertyIndividual>(),
             std::optional<AstartePropertyIndividual>{data});
 }
+
+TEST(AstarteTestMessage, SharedInterface) {
+  const AstarteInternedString interface(std::string("some.interface.Shared"));
+  auto first = AstarteMessage(interface, AstarteInternedString("/value"),
+                              AstarteDatastreamIndividual(AstarteData(1)));
+  auto second = AstarteMessage(std::string("some.interface.Shared"), std::string("/value"),
+                               AstarteDatastreamIndividual(AstarteData(1)));
+  const AstarteMessage copy = first;
+
+  EXPECT_TRUE(first.get_interface_handle().shares(interface));
+  EXPECT_FALSE(second.get_interface_handle().shares(interface));
+  EXPECT_TRUE(copy.get_path_handle().shares(first.get_path_handle()));
+  EXPECT_EQ(&first.get_interface(), &interface.get());
+  EXPECT_EQ(first, second);
+}
@@ -0,0 +1,77 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "multicast_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+
+using AstarteDeviceSdk::AstarteOverflowPolicy;
+using AstarteDeviceSdk::MulticastQueue;
+
+TEST(AstarteTestMulticastQueue, DeliversSharedItemToAllSubscribers) {
+  MulticastQueue<std::string> queue;
+  auto first = queue.subscribe();
+  auto second = queue.subscribe();
+  EXPECT_EQ(queue.subscribers(), 2);
+
+  EXPECT_TRUE(queue.push(std::string("payload")));
+  auto first_item = first->pop(std::chrono::milliseconds(0));
+  auto second_item = second->pop(std::chrono::milliseconds(0));
+  ASSERT_TRUE(first_item.has_value());
+  ASSERT_TRUE(second_item.has_value());
+  EXPECT_EQ(*first_item.value(), "payload");
+  // The item is decoded once and shared between the subscribers
+  EXPECT_EQ(first_item.value().get(), second_item.value().get());
+  EXPECT_EQ(queue.dropped(), 0);
+}
+
+TEST(AstarteTestMulticastQueue, DropsWithoutSubscribers) {
+  MulticastQueue<int> queue;
+  EXPECT_FALSE(queue.push(1));
+  EXPECT_EQ(queue.dropped(), 1);
+
+  auto subscriber = queue.subscribe();
+  EXPECT_TRUE(queue.push(2));
+  std::vector<std::shared_ptr<const int>> out;
+  EXPECT_EQ(subscriber->pop_batch(out, 10, std::chrono::milliseconds(0)), 1);
+  EXPECT_EQ(*out[0], 2);
+}
+
+TEST(AstarteTestMulticastQueue, ReleasedSubscriberIsRemoved) {
+  MulticastQueue<int> queue;
+  auto kept = queue.subscribe();
+  {
+    auto released = queue.subscribe();
+    EXPECT_EQ(queue.subscribers(), 2);
+  }
+  EXPECT_EQ(queue.subscribers(), 1);
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_EQ(kept->size(), 1);
+  EXPECT_EQ(queue.dropped(), 0);
+}
+
+TEST(AstarteTestMulticastQueue, BoundedSubscribersDropIndependently) {
+  MulticastQueue<int> queue(1, AstarteOverflowPolicy::kDropNewest);
+  auto slow = queue.subscribe();
+  auto fast = queue.subscribe();
+
+  EXPECT_TRUE(queue.push(1));
+  ASSERT_TRUE(fast->pop(std::chrono::milliseconds(0)).has_value());
+  // Only the slow subscriber is full
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_EQ(slow->dropped(), 1);
+  EXPECT_EQ(fast->dropped(), 0);
+  EXPECT_EQ(queue.dropped(), 1);
+
+  EXPECT_EQ(*slow->pop(std::chrono::milliseconds(0)).value(), 1);
+  EXPECT_EQ(*fast->pop(std::chrono::milliseconds(0)).value(), 2);
+}
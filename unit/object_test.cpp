@@ -0,0 +1,80 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/object.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+
+TEST(AstarteTestObject, IterationIsSortedByPath) {
+  AstarteDatastreamObject object = {{"/c", AstarteData(3)},
+                                    {"/a", AstarteData(1)},
+                                    {"/b", AstarteData(2)}};
+  std::vector<std::string> paths;
+  for (const auto& [path, data] : object) {
+    paths.push_back(path);
+  }
+  EXPECT_EQ(paths, (std::vector<std::string>{"/a", "/b", "/c"}));
+}
+
+TEST(AstarteTestObject, LookupWithStringView) {
+  AstarteDatastreamObject object;
+  object.reserve(2);
+  object.insert("/temperature", AstarteData(21.5));
+  object.insert("/humidity", AstarteData(40));
+
+  constexpr std::string_view key("/humidity");
+  EXPECT_TRUE(object.contains(key));
+  EXPECT_FALSE(object.contains("/pressure"));
+  EXPECT_EQ(object.at(key), AstarteData(40));
+  EXPECT_EQ(object.find("/pressure"), object.end());
+  EXPECT_THROW(object.at("/pressure"), std::out_of_range);
+}
+
+TEST(AstarteTestObject, InsertKeepsExistingKey) {
+  AstarteDatastreamObject object;
+  object.insert("/value", AstarteData(1));
+  object.insert("/value", AstarteData(2));
+  EXPECT_EQ(object.size(), 1);
+  EXPECT_EQ(object.at("/value"), AstarteData(1));
+}
+
+TEST(AstarteTestObject, EraseAndEquality) {
+  AstarteDatastreamObject first = {{"/a", AstarteData(1)}, {"/b", AstarteData(2)}};
+  AstarteDatastreamObject second = {{"/b", AstarteData(2)}, {"/a", AstarteData(1)}};
+  EXPECT_EQ(first, second);
+
+  EXPECT_EQ(first.erase("/a"), 1);
+  EXPECT_EQ(first.erase("/a"), 0);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first.size(), 1);
+}
+
+TEST(AstarteTestObject, PathsReadOnlyThroughIterators) {
+  AstarteDatastreamObject object = {{"/a", AstarteData(1)}, {"/b", AstarteData(2)}};
+  static_assert(std::is_same_v<decltype((*object.begin()).first), const std::string&>);
+  static_assert(std::is_same_v<decltype((*object.begin()).second), AstarteData&>);
+
+  for (auto&& [path, data] : object) {
+    data = AstarteData(path + "!");
+  }
+  object.find("/b")->second = AstarteData(3);
+  EXPECT_EQ(object.at("/a"), AstarteData(std::string("/a!")));
+  EXPECT_EQ(object.at("/b"), AstarteData(3));
+
+  AstarteDatastreamObject::const_iterator last = --object.end();
+  EXPECT_EQ(last->first, "/b");
+  EXPECT_EQ(last, object.find("/b"));
+}
@@ -0,0 +1,99 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ordered_worker_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using AstarteDeviceSdk::OrderedWorkerPool;
+
+TEST(AstarteTestOrderedWorkerPool, PreservesOrderPerKey) {
+  constexpr std::size_t keys = 8;
+  constexpr int items_per_key = 500;
+  std::mutex mutex;
+  std::vector<std::vector<int>> processed(keys);
+  {
+    OrderedWorkerPool<std::pair<std::size_t, int>> pool(
+        4, 16, [&](std::pair<std::size_t, int>&& item) {
+          const std::lock_guard<std::mutex> lock(mutex);
+          processed[item.first].push_back(item.second);
+        });
+    const std::stop_source source;
+    for (int i = 0; i < items_per_key; ++i) {
+      for (std::size_t key = 0; key < keys; ++key) {
+        EXPECT_TRUE(pool.submit(key, {key, i}, source.get_token()));
+      }
+    }
+  }
+  for (const auto& items : processed) {
+    ASSERT_EQ(items.size(), items_per_key);
+    for (int i = 0; i < items_per_key; ++i) {
+      EXPECT_EQ(items[i], i);
+    }
+  }
+}
+
+TEST(AstarteTestOrderedWorkerPool, ProcessesConcurrently) {
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  {
+    OrderedWorkerPool<std::size_t> pool(2, 0, [&](std::size_t&& /*item*/) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      const std::lock_guard<std::mutex> lock(mutex);
+      threads.insert(std::this_thread::get_id());
+    });
+    const std::stop_source source;
+    for (std::size_t i = 0; i < 20; ++i) {
+      pool.submit(i, i, source.get_token());
+    }
+  }
+  EXPECT_EQ(threads.size(), 2);
+}
+
+TEST(AstarteTestOrderedWorkerPool, DestructionProcessesPendingItems) {
+  std::atomic_int processed{0};
+  {
+    OrderedWorkerPool<std::unique_ptr<int>> pool(1, 0, [&](std::unique_ptr<int>&& item) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      processed += *item;
+    });
+    const std::stop_source source;
+    for (int i = 0; i < 10; ++i) {
+      pool.submit(0, std::make_unique<int>(1), source.get_token());
+    }
+  }
+  EXPECT_EQ(processed.load(), 10);
+}
+
+TEST(AstarteTestOrderedWorkerPool, StoppedSubmitOnFullQueueDrops) {
+  std::atomic_bool started{false};
+  std::atomic_bool release{false};
+  OrderedWorkerPool<int> pool(1, 1, [&](int&& /*item*/) {
+    started.store(true);
+    while (!release.load()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  std::stop_source source;
+  EXPECT_TRUE(pool.submit(0, 0, source.get_token()));
+  // Wait for the worker to take the first item, then fill the queue
+  while (!started.load()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_TRUE(pool.submit(0, 1, source.get_token()));
+  source.request_stop();
+  EXPECT_FALSE(pool.submit(0, 2, source.get_token()));
+  release.store(true);
+}
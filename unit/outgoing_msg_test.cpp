@@ -0,0 +1,66 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/outgoing_msg.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteOutgoingMessage;
+using AstarteDeviceSdk::AstartePropertyIndividual;
+
+TEST(AstarteTestOutgoingMessage, InstantiationDatastreamIndividual) {
+  std::string interface("some.interface.Name");
+  std::string endpoint("/some_endpoint");
+  auto data = AstarteDatastreamIndividual(AstarteData((int32_t)43));
+  auto timestamp = std::chrono::system_clock::now();
+  auto msg = AstarteOutgoingMessage(interface, endpoint, data, timestamp);
+
+  EXPECT_EQ(msg.get_interface(), interface);
+  EXPECT_EQ(msg.get_path(), endpoint);
+  EXPECT_EQ(msg.get_timestamp(), timestamp);
+  EXPECT_EQ(std::get<AstarteDatastreamIndividual>(msg.get_raw_data()), data);
+}
+
+TEST(AstarteTestOutgoingMessage, InstantiationDatastreamObject) {
+  std::string interface("some.interface.Name");
+  std::string endpoint_common("/some_base_endpoint");
+  AstarteDatastreamObject data = {{"/some_endpoint", AstarteData(43)},
+                                  {"/some_other_endpoint", AstarteData(43.5)}};
+  auto msg = AstarteOutgoingMessage(interface, endpoint_common, data);
+
+  EXPECT_EQ(msg.get_interface(), interface);
+  EXPECT_EQ(msg.get_path(), endpoint_common);
+  EXPECT_EQ(msg.get_timestamp(), std::nullopt);
+  EXPECT_EQ(std::get<AstarteDatastreamObject>(msg.get_raw_data()), data);
+}
+
+TEST(AstarteTestOutgoingMessage, InstantiationPropertyUnset) {
+  std::string interface("some.interface.Name");
+  std::string endpoint("/some_endpoint");
+  auto data = AstartePropertyIndividual(std::nullopt);
+  auto msg = AstarteOutgoingMessage(interface, endpoint, data);
+
+  EXPECT_EQ(msg.get_interface(), interface);
+  EXPECT_EQ(msg.get_path(), endpoint);
+  EXPECT_EQ(std::get<AstartePropertyIndividual>(msg.get_raw_data()).get_value(), std::nullopt);
+}
+
+TEST(AstarteTestOutgoingMessage, Comparison) {
+  auto timestamp = std::chrono::system_clock::now();
+  auto data = AstarteDatastreamIndividual(AstarteData(12.5));
+  auto msg = AstarteOutgoingMessage("some.interface.Name", "/some_endpoint", data, timestamp);
+  auto same_msg = AstarteOutgoingMessage("some.interface.Name", "/some_endpoint", data, timestamp);
+  auto other_msg = AstarteOutgoingMessage("some.interface.Name", "/some_endpoint", data);
+
+  EXPECT_EQ(msg, same_msg);
+  EXPECT_NE(msg, other_msg);
+}
@@ -0,0 +1,84 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/series.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/type.hpp"
+#include "grpc_arena.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamSeries;
+using AstarteDeviceSdk::AstarteType;
+using AstarteDeviceSdk::gRPCAstarteDatastreamIndividual;
+using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcConverterTo;
+using AstarteDeviceSdk::GrpcMessageArena;
+
+TEST(AstarteTestSeries, Instantiation) {
+  const auto now = std::chrono::system_clock::now();
+  const std::vector<std::chrono::system_clock::time_point> timestamps = {
+      now, now + std::chrono::milliseconds(1)};
+  const AstarteDatastreamSeries series(std::vector<int64_t>{12, 13}, timestamps);
+
+  EXPECT_EQ(series.size(), 2U);
+  EXPECT_FALSE(series.empty());
+  EXPECT_EQ(series.get_type(), AstarteType::kLongInteger);
+  EXPECT_EQ(series.get_timestamps(), timestamps);
+  EXPECT_EQ(std::get<std::vector<int64_t>>(series.get_raw_data()), std::vector<int64_t>({12, 13}));
+  EXPECT_EQ(series.value_at(1), AstarteData(int64_t{13}));
+}
+
+TEST(AstarteTestSeries, PushBack) {
+  const auto now = std::chrono::system_clock::now();
+  AstarteDatastreamSeries series(std::vector<bool>{}, {});
+  series.reserve(3);
+  series.push_back(true, now);
+  series.push_back(false, now);
+  EXPECT_EQ(series.size(), 2U);
+  EXPECT_EQ(series.get_type(), AstarteType::kBoolean);
+  EXPECT_EQ(series.value_at(0), AstarteData(true));
+  EXPECT_EQ(series.value_at(1), AstarteData(false));
+  EXPECT_THROW(series.push_back(1.0, now), std::bad_variant_access);
+
+  const AstarteDatastreamSeries expected(std::vector<bool>{true, false}, {now, now});
+  EXPECT_EQ(series, expected);
+  series.clear();
+  EXPECT_TRUE(series.empty());
+  EXPECT_EQ(series.get_type(), AstarteType::kBoolean);
+  EXPECT_NE(series, expected);
+}
+
+TEST(AstarteTestSeries, FillSamples) {
+  const auto now = std::chrono::system_clock::now();
+  const AstarteDatastreamSeries series(std::vector<std::string>{"first", "second"},
+                                       {now, now + std::chrono::seconds(1)});
+  GrpcMessageArena arena;
+  auto* grpc_individual = arena.create<gRPCAstarteDatastreamIndividual>();
+  for (std::size_t i = 0; i < series.size(); ++i) {
+    // The same message is overwritten by each sample
+    GrpcConverterTo::fill(series, i, grpc_individual);
+    auto individual = GrpcConverterFrom{}(*grpc_individual);
+    ASSERT_TRUE(individual.has_value());
+    EXPECT_EQ(individual.value(), AstarteDatastreamIndividual(series.value_at(i)));
+    EXPECT_TRUE(grpc_individual->has_timestamp());
+    EXPECT_EQ(grpc_individual->timestamp().seconds(),
+              std::chrono::duration_cast<std::chrono::seconds>(
+                  series.get_timestamps()[i].time_since_epoch())
+                  .count());
+  }
+}
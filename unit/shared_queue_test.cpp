@@ -0,0 +1,143 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "shared_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+
+using AstarteDeviceSdk::AstarteOverflowPolicy;
+using AstarteDeviceSdk::SharedQueue;
+
+TEST(AstarteTestSharedQueue, PopBatchDrainsUpToMax) {
+  SharedQueue<int> queue;
+  for (int i = 0; i < 10; ++i) {
+    queue.push(i);
+  }
+
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_batch(out, 4, std::chrono::milliseconds(0)), 4);
+  EXPECT_EQ(out, std::vector<int>({0, 1, 2, 3}));
+  EXPECT_EQ(queue.pop_batch(out, 100, std::chrono::milliseconds(0)), 6);
+  EXPECT_EQ(out.size(), 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(out[i], i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(AstarteTestSharedQueue, PopBatchTimeout) {
+  SharedQueue<int> queue;
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_batch(out, 4, std::chrono::milliseconds(10)), 0);
+  EXPECT_TRUE(out.empty());
+  queue.push(1);
+  EXPECT_EQ(queue.pop_batch(out, 0, std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(queue.size(), 1);
+}
+
+TEST(AstarteTestSharedQueue, PopBatchWaitsForFirstItem) {
+  SharedQueue<int> queue;
+  std::jthread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.push(42);
+  });
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_batch(out, 4, std::chrono::seconds(5)), 1);
+  EXPECT_EQ(out, std::vector<int>({42}));
+}
+
+TEST(AstarteTestSharedQueue, BoundedDropNewest) {
+  SharedQueue<int> queue(2, AstarteOverflowPolicy::kDropNewest);
+  EXPECT_TRUE(queue.push(0));
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_FALSE(queue.push(2));
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.dropped(), 1);
+  EXPECT_EQ(queue.pop(std::chrono::milliseconds(0)), 0);
+}
+
+TEST(AstarteTestSharedQueue, BoundedDropOldest) {
+  SharedQueue<int> queue(2, AstarteOverflowPolicy::kDropOldest);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(queue.push(i));
+  }
+  EXPECT_EQ(queue.dropped(), 3);
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_batch(out, 10, std::chrono::milliseconds(0)), 2);
+  EXPECT_EQ(out, std::vector<int>({3, 4}));
+}
+
+TEST(AstarteTestSharedQueue, BoundedBlockWaitsForConsumer) {
+  SharedQueue<int> queue(1, AstarteOverflowPolicy::kBlock);
+  EXPECT_TRUE(queue.push(0));
+  std::jthread consumer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    (void)queue.pop(std::chrono::milliseconds(0));
+  });
+  EXPECT_TRUE(queue.push(1));
+  consumer.join();
+  EXPECT_EQ(queue.pop(std::chrono::milliseconds(0)), 1);
+  EXPECT_EQ(queue.dropped(), 0);
+}
+
+TEST(AstarteTestSharedQueue, BoundedBlockInterruptedByStop) {
+  SharedQueue<int> queue(1, AstarteOverflowPolicy::kBlock);
+  EXPECT_TRUE(queue.push(0));
+  std::stop_source source;
+  std::jthread stopper([&source]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    source.request_stop();
+  });
+  EXPECT_FALSE(queue.push(1, source.get_token()));
+  EXPECT_EQ(queue.size(), 1);
+  EXPECT_EQ(queue.dropped(), 1);
+}
+
+TEST(AstarteTestSharedQueue, BoundedFailIsNotCounted) {
+  SharedQueue<int> queue(2, AstarteOverflowPolicy::kFail);
+  EXPECT_TRUE(queue.push(0));
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_FALSE(queue.push(2));
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.dropped(), 0);
+  EXPECT_EQ(queue.pop(std::chrono::milliseconds(0)), 0);
+}
+
+TEST(AstarteTestSharedQueue, CloseReleasesBlockedProducers) {
+  SharedQueue<int> queue(1, AstarteOverflowPolicy::kBlock);
+  EXPECT_TRUE(queue.push(0));
+  std::jthread closer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+  });
+  EXPECT_FALSE(queue.push(1));
+  closer.join();
+  EXPECT_FALSE(queue.push(2));
+  EXPECT_EQ(queue.dropped(), 0);
+  EXPECT_EQ(queue.pop(std::chrono::milliseconds(0)), 0);
+}
+
+TEST(AstarteTestSharedQueue, PopBatchReleasesAllBlockedProducers) {
+  SharedQueue<int> queue(2, AstarteOverflowPolicy::kBlock);
+  EXPECT_TRUE(queue.push(0));
+  EXPECT_TRUE(queue.push(1));
+  std::vector<std::jthread> producers;
+  for (int i = 2; i < 4; ++i) {
+    producers.emplace_back([&queue, i]() { EXPECT_TRUE(queue.push(i)); });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_batch(out, 2, std::chrono::milliseconds(0)), 2);
+  // Both producers are woken up by a single batch
+  producers.clear();
+  EXPECT_EQ(queue.size(), 2);
+}
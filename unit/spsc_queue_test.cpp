@@ -0,0 +1,139 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "spsc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/overflow_policy.hpp"
+
+using AstarteDeviceSdk::AstarteOverflowPolicy;
+using AstarteDeviceSdk::SpscQueue;
+
+TEST(AstarteTestSpscQueue, KeepsOrderAcrossBlocks) {
+  SpscQueue<std::string> queue;
+  for (int i = 0; i < 1000; ++i) {
+    queue.push(std::to_string(i));
+  }
+  EXPECT_EQ(queue.size(), 1000);
+  for (int i = 0; i < 1000; ++i) {
+    auto item = queue.pop(std::chrono::milliseconds(0));
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(item.value(), std::to_string(i));
+  }
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(std::chrono::milliseconds(0)).has_value());
+}
+
+TEST(AstarteTestSpscQueue, MoveOnlyItems) {
+  SpscQueue<std::unique_ptr<int>> queue;
+  queue.push(std::make_unique<int>(42));
+  auto item = queue.pop(std::chrono::milliseconds(0));
+  ASSERT_TRUE(item.has_value());
+  EXPECT_EQ(*item.value(), 42);
+}
+
+TEST(AstarteTestSpscQueue, PopBatch) {
+  SpscQueue<int> queue;
+  for (int i = 0; i < 300; ++i) {
+    queue.push(i);
+  }
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_batch(out, 200, std::chrono::milliseconds(0)), 200);
+  EXPECT_EQ(queue.pop_batch(out, 200, std::chrono::milliseconds(0)), 100);
+  EXPECT_EQ(queue.pop_batch(out, 200, std::chrono::milliseconds(10)), 0);
+  ASSERT_EQ(out.size(), 300);
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(out[i], i);
+  }
+}
+
+TEST(AstarteTestSpscQueue, BlockingPopIsWokenUp) {
+  SpscQueue<int> queue;
+  std::jthread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.push(42);
+  });
+  auto item = queue.pop(std::chrono::seconds(5));
+  ASSERT_TRUE(item.has_value());
+  EXPECT_EQ(item.value(), 42);
+}
+
+TEST(AstarteTestSpscQueue, ConcurrentProducerConsumer) {
+  constexpr int count = 200000;
+  SpscQueue<int> queue;
+  std::jthread producer([&queue]() {
+    for (int i = 0; i < count; ++i) {
+      queue.push(i);
+    }
+  });
+
+  int expected = 0;
+  std::vector<int> out;
+  while (expected < count) {
+    out.clear();
+    if (queue.pop_batch(out, 64, std::chrono::seconds(5)) == 0) {
+      break;
+    }
+    for (int item : out) {
+      ASSERT_EQ(item, expected);
+      expected++;
+    }
+  }
+  EXPECT_EQ(expected, count);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(AstarteTestSpscQueue, BoundedDropNewest) {
+  SpscQueue<int> queue(2, AstarteOverflowPolicy::kDropNewest);
+  EXPECT_TRUE(queue.push(0));
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_FALSE(queue.push(2));
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.dropped(), 1);
+  EXPECT_EQ(queue.pop(std::chrono::milliseconds(0)), 0);
+  EXPECT_TRUE(queue.push(3));
+}
+
+TEST(AstarteTestSpscQueue, BoundedBlockInterruptedByStop) {
+  SpscQueue<int> queue(1, AstarteOverflowPolicy::kBlock);
+  EXPECT_TRUE(queue.push(0));
+  std::stop_source source;
+  std::jthread stopper([&source]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    source.request_stop();
+  });
+  EXPECT_FALSE(queue.push(1, source.get_token()));
+  EXPECT_EQ(queue.size(), 1);
+  EXPECT_EQ(queue.dropped(), 1);
+}
+
+TEST(AstarteTestSpscQueue, BoundedBlockBackpressure) {
+  constexpr int count = 100000;
+  SpscQueue<int> queue(16, AstarteOverflowPolicy::kBlock);
+  std::jthread producer([&queue]() {
+    for (int i = 0; i < count; ++i) {
+      queue.push(i);
+    }
+  });
+
+  int expected = 0;
+  while (expected < count) {
+    auto item = queue.pop(std::chrono::seconds(5));
+    ASSERT_TRUE(item.has_value());
+    ASSERT_EQ(item.value(), expected);
+    ASSERT_LE(queue.size(), 16);
+    expected++;
+  }
+  EXPECT_EQ(queue.dropped(), 0);
+}
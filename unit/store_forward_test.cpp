@@ -0,0 +1,245 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+
+#include "astarte_device_sdk/store_forward.hpp"
+#include "interface.hpp"
+#include "segment_log.hpp"
+#include "store_forward_buffer.hpp"
+
+using AstarteDeviceSdk::AstarteRetention;
+using AstarteDeviceSdk::AstarteStoreForwardConfig;
+using AstarteDeviceSdk::gRPCAstarteMessage;
+using AstarteDeviceSdk::SegmentLog;
+using AstarteDeviceSdk::StoreForwardBuffer;
+
+namespace {
+class AstarteTestStoreForward : public testing::Test {
+ protected:
+  void SetUp() override {
+    const std::string name = testing::UnitTest::GetInstance()->current_test_info()->name();
+    dir_ = std::filesystem::temp_directory_path() / ("astarte_sf_" + name);
+    std::filesystem::remove_all(dir_);
+  }
+  void TearDown() override { std::filesystem::remove_all(dir_); }
+
+  std::filesystem::path dir_;
+};
+
+auto make_message(const std::string& path) -> gRPCAstarteMessage {
+  gRPCAstarteMessage message;
+  message.set_interface_name("org.astarte.test.Datastream");
+  message.set_path(path);
+  message.mutable_datastream_individual();
+  return message;
+}
+
+auto front_path(StoreForwardBuffer& buffer) -> std::optional<std::string> {
+  auto message = buffer.front(std::chrono::milliseconds(0));
+  if (!message) {
+    return std::nullopt;
+  }
+  return message->message.path();
+}
+
+// Remove the oldest message, as the replay does once it has been transmitted
+void pop_front(StoreForwardBuffer& buffer) {
+  auto entry = buffer.front(std::chrono::milliseconds(0));
+  ASSERT_TRUE(entry);
+  buffer.pop(entry->seq);
+}
+}  // namespace
+
+TEST_F(AstarteTestStoreForward, SegmentLogReopen) {
+  {
+    auto log = SegmentLog::open(dir_, 64, 1024);
+    ASSERT_TRUE(log);
+    for (std::uint64_t i = 0; i < 5; ++i) {
+      const std::string payload = "payload" + std::to_string(i);
+      ASSERT_TRUE(log->append({.seq = i, .expiry_ms = 0, .payload = payload}));
+    }
+    EXPECT_EQ(log->last_seq(), std::optional<std::uint64_t>(4));
+  }
+
+  auto log = SegmentLog::open(dir_, 64, 1024);
+  ASSERT_TRUE(log);
+  EXPECT_EQ(log->last_seq(), std::optional<std::uint64_t>(4));
+  for (std::uint64_t i = 0; i < 5; ++i) {
+    const auto* record = log->front();
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->seq, i);
+    EXPECT_EQ(record->payload, "payload" + std::to_string(i));
+    log->pop();
+  }
+  EXPECT_TRUE(log->empty());
+  EXPECT_EQ(log->front(), nullptr);
+}
+
+TEST_F(AstarteTestStoreForward, SegmentLogResumesAfterRestart) {
+  {
+    auto log = SegmentLog::open(dir_, 1024, 4096);
+    ASSERT_TRUE(log);
+    for (std::uint64_t i = 0; i < 5; ++i) {
+      ASSERT_TRUE(log->append({.seq = i, .expiry_ms = 0, .payload = "payload"}));
+    }
+    log->pop();
+    log->pop();
+  }
+
+  // Records consumed before the restart are not read again
+  auto log = SegmentLog::open(dir_, 1024, 4096);
+  ASSERT_TRUE(log);
+  ASSERT_NE(log->front(), nullptr);
+  EXPECT_EQ(log->front()->seq, 2);
+  EXPECT_EQ(log->last_seq(), std::optional<std::uint64_t>(4));
+}
+
+TEST_F(AstarteTestStoreForward, SegmentLogRemovesConsumedSegments) {
+  auto count_segments = [this]() {
+    std::size_t count = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir_)) {
+      count += (entry.path().extension() == ".seg") ? 1 : 0;
+    }
+    return count;
+  };
+  {
+    auto log = SegmentLog::open(dir_, 1024, 4096);
+    ASSERT_TRUE(log);
+    ASSERT_TRUE(log->append({.seq = 0, .expiry_ms = 0, .payload = "first"}));
+    log->pop();
+    EXPECT_TRUE(log->empty());
+    EXPECT_EQ(count_segments(), 0);
+    ASSERT_TRUE(log->append({.seq = 1, .expiry_ms = 0, .payload = "second"}));
+    EXPECT_EQ(count_segments(), 1);
+  }
+
+  auto log = SegmentLog::open(dir_, 1024, 4096);
+  ASSERT_TRUE(log);
+  ASSERT_NE(log->front(), nullptr);
+  EXPECT_EQ(log->front()->payload, "second");
+  log->pop();
+  EXPECT_EQ(log->front(), nullptr);
+}
+
+TEST_F(AstarteTestStoreForward, SegmentLogTruncatedTail) {
+  {
+    auto log = SegmentLog::open(dir_, 1024, 4096);
+    ASSERT_TRUE(log);
+    ASSERT_TRUE(log->append({.seq = 0, .expiry_ms = 0, .payload = "complete"}));
+  }
+  // Simulate a power loss while writing a record
+  for (const auto& entry : std::filesystem::directory_iterator(dir_)) {
+    std::ofstream file(entry.path(), std::ios::binary | std::ios::app);
+    file.write("\x01\x02\x03", 3);
+  }
+
+  auto log = SegmentLog::open(dir_, 1024, 4096);
+  ASSERT_TRUE(log);
+  EXPECT_EQ(log->last_seq(), std::optional<std::uint64_t>(0));
+  ASSERT_TRUE(log->append({.seq = 1, .expiry_ms = 0, .payload = "next"}));
+  ASSERT_NE(log->front(), nullptr);
+  EXPECT_EQ(log->front()->payload, "complete");
+  log->pop();
+  ASSERT_NE(log->front(), nullptr);
+  EXPECT_EQ(log->front()->payload, "next");
+}
+
+TEST_F(AstarteTestStoreForward, SegmentLogMaxSize) {
+  auto log = SegmentLog::open(dir_, 64, 256);
+  ASSERT_TRUE(log);
+  for (std::uint64_t i = 0; i < 50; ++i) {
+    ASSERT_TRUE(log->append({.seq = i, .expiry_ms = 0, .payload = std::string(20, 'x')}));
+  }
+  const auto* record = log->front();
+  ASSERT_NE(record, nullptr);
+  EXPECT_GT(record->seq, 0);
+}
+
+TEST_F(AstarteTestStoreForward, OrderAcrossRetentions) {
+  auto buffer = StoreForwardBuffer::create({.storage_dir = dir_});
+  ASSERT_TRUE(buffer);
+  auto& sf = *buffer.value();
+  EXPECT_TRUE(sf.empty());
+  ASSERT_TRUE(sf.push(make_message("/a"), AstarteRetention::kStored, std::chrono::seconds(0)));
+  ASSERT_TRUE(sf.push(make_message("/b"), AstarteRetention::kVolatile, std::chrono::seconds(0)));
+  ASSERT_TRUE(sf.push(make_message("/c"), AstarteRetention::kStored, std::chrono::seconds(0)));
+  EXPECT_FALSE(sf.empty());
+
+  for (const auto* path : {"/a", "/b", "/c"}) {
+    EXPECT_EQ(front_path(sf), std::optional<std::string>(path));
+    pop_front(sf);
+  }
+  EXPECT_TRUE(sf.empty());
+  EXPECT_EQ(front_path(sf), std::nullopt);
+}
+
+TEST_F(AstarteTestStoreForward, StoredSurvivesRestart) {
+  {
+    auto buffer = StoreForwardBuffer::create({.storage_dir = dir_});
+    ASSERT_TRUE(buffer);
+    ASSERT_TRUE((*buffer)->push(make_message("/a"), AstarteRetention::kStored,
+                                std::chrono::seconds(0)));
+    ASSERT_TRUE((*buffer)->push(make_message("/b"), AstarteRetention::kVolatile,
+                                std::chrono::seconds(0)));
+  }
+  auto buffer = StoreForwardBuffer::create({.storage_dir = dir_});
+  ASSERT_TRUE(buffer);
+  ASSERT_TRUE(
+      (*buffer)->push(make_message("/c"), AstarteRetention::kVolatile, std::chrono::seconds(0)));
+  EXPECT_EQ(front_path(**buffer), std::optional<std::string>("/a"));
+  pop_front(**buffer);
+  EXPECT_EQ(front_path(**buffer), std::optional<std::string>("/c"));
+}
+
+TEST_F(AstarteTestStoreForward, VolatileOverflowDropsOldest) {
+  auto buffer = StoreForwardBuffer::create({.volatile_capacity = 2});
+  ASSERT_TRUE(buffer);
+  auto& sf = *buffer.value();
+  for (const auto* path : {"/a", "/b", "/c"}) {
+    ASSERT_TRUE(sf.push(make_message(path), AstarteRetention::kVolatile, std::chrono::seconds(0)));
+  }
+  EXPECT_EQ(front_path(sf), std::optional<std::string>("/b"));
+  pop_front(sf);
+  EXPECT_EQ(front_path(sf), std::optional<std::string>("/c"));
+}
+
+TEST_F(AstarteTestStoreForward, PopKeepsMessagePushedOverTheFront) {
+  auto buffer = StoreForwardBuffer::create({.volatile_capacity = 2});
+  ASSERT_TRUE(buffer);
+  auto& sf = *buffer.value();
+  ASSERT_TRUE(sf.push(make_message("/a"), AstarteRetention::kVolatile, std::chrono::seconds(0)));
+  ASSERT_TRUE(sf.push(make_message("/b"), AstarteRetention::kVolatile, std::chrono::seconds(0)));
+  auto sent = sf.front(std::chrono::milliseconds(0));
+  ASSERT_TRUE(sent);
+  EXPECT_EQ(sent->message.path(), "/a");
+  // The overflow discards the message being transmitted, /b is now at the front
+  ASSERT_TRUE(sf.push(make_message("/c"), AstarteRetention::kVolatile, std::chrono::seconds(0)));
+  sf.pop(sent->seq);
+  EXPECT_EQ(front_path(sf), std::optional<std::string>("/b"));
+}
+
+TEST_F(AstarteTestStoreForward, ExpiredDiscarded) {
+  auto buffer = StoreForwardBuffer::create({.storage_dir = dir_});
+  ASSERT_TRUE(buffer);
+  auto& sf = *buffer.value();
+  ASSERT_TRUE(sf.push(make_message("/a"), AstarteRetention::kVolatile, std::chrono::seconds(-1)));
+  ASSERT_TRUE(sf.push(make_message("/b"), AstarteRetention::kStored, std::chrono::seconds(-1)));
+  ASSERT_TRUE(sf.push(make_message("/c"), AstarteRetention::kStored, std::chrono::seconds(60)));
+  EXPECT_EQ(front_path(sf), std::optional<std::string>("/c"));
+}
+
+TEST_F(AstarteTestStoreForward, InvalidConfig) {
+  EXPECT_FALSE(StoreForwardBuffer::create({.volatile_capacity = 0}));
+}
@@ -0,0 +1,98 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "subscription_router.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/errors.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteInvalidInputError;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::SubscriptionRouter;
+
+namespace {
+constexpr std::string_view interface_name("org.astarte.test.ServerDatastream");
+
+auto make_message(std::string_view interface, std::string_view path) -> AstarteMessage {
+  return {interface, path, AstarteDatastreamIndividual(AstarteData(int32_t{1}))};
+}
+}  // namespace
+
+TEST(AstarteTestSubscriptionRouter, ExactAndParametricSegments) {
+  SubscriptionRouter router;
+  std::vector<std::string> routed;
+  ASSERT_TRUE(router.subscribe(interface_name, "/%{sensor_id}/value",
+                               [&](const AstarteMessage& msg) {
+                                 routed.push_back("parametric " + msg.get_path());
+                               }));
+  ASSERT_TRUE(router.subscribe(interface_name, "/room/value", [&](const AstarteMessage& msg) {
+    routed.push_back("exact " + msg.get_path());
+  }));
+
+  EXPECT_EQ(router.route(make_message(interface_name, "/temp/value")), 1);
+  EXPECT_EQ(router.route(make_message(interface_name, "/room/value")), 2);
+  EXPECT_EQ(router.route(make_message(interface_name, "/temp/other")), 0);
+  EXPECT_EQ(router.route(make_message(interface_name, "/temp/value/more")), 0);
+  EXPECT_EQ(router.route(make_message(interface_name, "//value")), 0);
+  EXPECT_EQ(router.route(make_message("org.astarte.test.Other", "/temp/value")), 0);
+  const std::vector<std::string> expected = {"parametric /temp/value", "exact /room/value",
+                                             "parametric /room/value"};
+  EXPECT_EQ(routed, expected);
+}
+
+TEST(AstarteTestSubscriptionRouter, Unsubscribe) {
+  SubscriptionRouter router;
+  int count = 0;
+  auto subscription =
+      router.subscribe(interface_name, "/value", [&](const AstarteMessage&) { count++; });
+  ASSERT_TRUE(subscription);
+  EXPECT_FALSE(router.empty());
+  EXPECT_EQ(router.route(make_message(interface_name, "/value")), 1);
+  EXPECT_TRUE(router.unsubscribe(subscription.value()));
+  EXPECT_FALSE(router.unsubscribe(subscription.value()));
+  EXPECT_TRUE(router.empty());
+  EXPECT_EQ(router.route(make_message(interface_name, "/value")), 0);
+  EXPECT_EQ(count, 1);
+}
+
+TEST(AstarteTestSubscriptionRouter, SubscribeFromHandler) {
+  SubscriptionRouter router;
+  int nested = 0;
+  ASSERT_TRUE(router.subscribe(interface_name, "/value", [&](const AstarteMessage&) {
+    ASSERT_TRUE(router.subscribe(interface_name, "/value", [&](const AstarteMessage&) {
+      nested++;
+    }));
+  }));
+  // The new subscription only applies to the following messages
+  EXPECT_EQ(router.route(make_message(interface_name, "/value")), 1);
+  EXPECT_EQ(nested, 0);
+  EXPECT_EQ(router.route(make_message(interface_name, "/value")), 2);
+  EXPECT_EQ(nested, 1);
+}
+
+TEST(AstarteTestSubscriptionRouter, InvalidPatterns) {
+  SubscriptionRouter router;
+  auto handler = [](const AstarteMessage&) {};
+  for (const std::string_view pattern :
+       {"", "value", "/", "/a//b", "/a/", "/%{}/value", "/%{id/value", "/a%{id}/value"}) {
+    auto res = router.subscribe(interface_name, pattern, handler);
+    ASSERT_FALSE(res) << pattern;
+    EXPECT_TRUE(std::holds_alternative<AstarteInvalidInputError>(res.error())) << pattern;
+  }
+  EXPECT_FALSE(router.subscribe("", "/value", handler));
+  EXPECT_FALSE(router.subscribe(interface_name, "/value", nullptr));
+  EXPECT_TRUE(router.empty());
+}
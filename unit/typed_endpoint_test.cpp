@@ -0,0 +1,95 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/typed_endpoint.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/type.hpp"
+#include "astarte_interfaces/org.astarte-platform.cpp.examples.DeviceAggregate.hpp"
+#include "astarte_interfaces/org.astarte-platform.cpp.examples.DeviceDatastream.hpp"
+#include "astarte_interfaces/org.astarte-platform.cpp.examples.DeviceProperty.hpp"
+#include "astarte_interfaces/org.astarte.test.KeywordsObject.hpp"
+#include "astarte_interfaces/org.astarte.test.new.Keywords.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteType;
+using AstarteDeviceSdk::AstarteTypedValue;
+using org::astarte::test::KeywordsObject;
+using org::astarte::test::new_::Keywords;
+using org::astarte_platform::cpp::examples::DeviceAggregate;
+using org::astarte_platform::cpp::examples::DeviceDatastream;
+using org::astarte_platform::cpp::examples::DeviceProperty;
+
+static_assert(AstarteTypedValue<int, AstarteType::kInteger>);
+static_assert(AstarteTypedValue<int32_t, AstarteType::kLongInteger>);
+static_assert(!AstarteTypedValue<int64_t, AstarteType::kInteger>);
+static_assert(!AstarteTypedValue<double, AstarteType::kInteger>);
+static_assert(!AstarteTypedValue<int, AstarteType::kBoolean>);
+static_assert(AstarteTypedValue<const char*, AstarteType::kString>);
+static_assert(!AstarteTypedValue<int, AstarteType::kIntegerArray>);
+static_assert(AstarteTypedValue<std::vector<double>, AstarteType::kDoubleArray>);
+static_assert(!AstarteTypedValue<std::vector<int32_t>, AstarteType::kDoubleArray>);
+// Integers and integer arrays are widened for long integer mappings, as done by the device
+static_assert(AstarteTypedValue<std::vector<int32_t>, AstarteType::kLongIntegerArray>);
+static_assert(!AstarteTypedValue<std::vector<int64_t>, AstarteType::kIntegerArray>);
+
+TEST(AstarteTestTypedEndpoint, GeneratedIndividual) {
+  EXPECT_EQ(DeviceDatastream::name, "org.astarte-platform.cpp.examples.DeviceDatastream");
+  EXPECT_EQ(DeviceDatastream::version_major, 0);
+  EXPECT_EQ(DeviceDatastream::version_minor, 1);
+  EXPECT_EQ(DeviceDatastream::integer_endpoint.interface_name(), DeviceDatastream::name);
+  EXPECT_EQ(DeviceDatastream::integer_endpoint.path(), "/integer_endpoint");
+  EXPECT_TRUE((std::is_same_v<decltype(DeviceDatastream::integer_endpoint)::value_type, int32_t>));
+  EXPECT_TRUE((std::is_same_v<decltype(DeviceProperty::stringarray_endpoint)::value_type,
+                              std::vector<std::string>>));
+}
+
+TEST(AstarteTestTypedEndpoint, WidenIntegerArray) {
+  const std::vector<int64_t> widened =
+      AstarteDeviceSdk::detail::to_typed_value<AstarteType::kLongIntegerArray>(
+          std::vector<int32_t>{1, -2});
+  EXPECT_EQ(widened, std::vector<int64_t>({1, -2}));
+  EXPECT_EQ(AstarteDeviceSdk::detail::to_typed_value<AstarteType::kLongInteger>(int32_t{-3}), -3);
+}
+
+TEST(AstarteTestTypedEndpoint, GeneratedObject) {
+  EXPECT_EQ(DeviceAggregate::object.path(), "/%{sensor_id}");
+
+  DeviceAggregate::Object values;
+  values.integer_endpoint = 43;
+  values.string_endpoint = "Hello";
+  auto object = values.to_object();
+  EXPECT_EQ(object.size(), 14);
+  EXPECT_EQ(object.at("integer_endpoint"), AstarteData(43));
+  EXPECT_EQ(object.at("string_endpoint"), AstarteData(std::string("Hello")));
+}
+
+TEST(AstarteTestTypedEndpoint, GeneratedKeywordsEscaped) {
+  EXPECT_EQ(Keywords::name, "org.astarte.test.new.Keywords");
+  EXPECT_EQ(Keywords::double_.path(), "/double");
+  EXPECT_EQ(Keywords::int_.path(), "/%{sensor_id}/int");
+  EXPECT_EQ(Keywords::default_.path(), "/default");
+  EXPECT_EQ(Keywords::_value.path(), "/__value");
+}
+
+TEST(AstarteTestTypedEndpoint, GeneratedObjectMoved) {
+  KeywordsObject::Object values;
+  values.class_ = 7;
+  values.label = std::string(64, 'l');
+  values.samples = {1.0, 2.0};
+  const char* label = values.label.data();
+  auto object = std::move(values).to_object();
+  EXPECT_EQ(object.at("class"), AstarteData(7));
+  EXPECT_EQ(object.at("label").into<std::string_view>().data(), label);
+  EXPECT_EQ(object.at("samples"), AstarteData(std::vector<double>{1.0, 2.0}));
+}